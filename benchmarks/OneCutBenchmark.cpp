@@ -0,0 +1,304 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <map>
+#include <numeric>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "OneCut/CompactSkeleton.h"
+#include "OneCut/FoldManager.h"
+#include "OneCut/PerpendicularFinder.h"
+#include "OneCut/SkeletonBuilder.h"
+#include "OneCut/StraightSkeleton.h"
+#include "OneCut/utils/PolygonGenerator.h"
+
+/*
+ * onecut_bench: times every stage of the crease pipeline on generated polygon families
+ * and writes the results as JSON.
+ *
+ * Usage: onecut_bench [--families convex,star,...] [--min-vertices N] [--max-vertices N]
+ *                     [--repetitions N] [--time-limit SECONDS] [--seed N] [--output FILE]
+ */
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+const std::vector<int> SIZES = {10, 30, 100, 300, 1000, 3000, 10000, 30000, 100000};
+
+struct Options {
+    std::vector<std::string> families = OneCut::PolygonGenerator::families();
+    int minVertices = 10;
+    int maxVertices = 100000;
+    int repetitions = 3;
+    double timeLimitSeconds = 60.0;
+    std::uint32_t seed = 42;
+    std::string output;
+};
+
+struct Result {
+    std::string family;
+    int vertices = 0;
+    size_t faces = 0;
+    size_t chains = 0;
+    size_t creases = 0;
+    std::string error;
+    std::map<std::string, std::vector<double>> stages;  ///< stage name -> duration of every repetition (ms)
+    OneCut::PipelineStats stats;                         ///< Counters of the last FoldManager run
+};
+
+double elapsedMs(Clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+std::vector<std::string> split(const std::string& list) {
+    std::vector<std::string> parts;
+    std::stringstream stream(list);
+    std::string part;
+    while (std::getline(stream, part, ',')) {
+        if (!part.empty()) parts.push_back(part);
+    }
+    return parts;
+}
+
+[[noreturn]] void exitWithUsage(int status) {
+    std::cerr << "Usage: onecut_bench [--families convex,star,spiral,comb,random] [--min-vertices N]\n"
+                 "                    [--max-vertices N] [--repetitions N] [--time-limit SECONDS]\n"
+                 "                    [--seed N] [--output FILE]"
+              << std::endl;
+    std::exit(status);
+}
+
+// Parses a seed; std::stoul alone would wrap negative numbers around and the cast would truncate large ones.
+std::uint32_t parseSeed(const std::string& text) {
+    if (text.find('-') != std::string::npos) {
+        throw std::invalid_argument(text);
+    }
+    unsigned long long seed = std::stoull(text);
+    if (seed > std::numeric_limits<std::uint32_t>::max()) {
+        throw std::out_of_range(text);
+    }
+    return static_cast<std::uint32_t>(seed);
+}
+
+Options parseOptions(int argc, char** argv) {
+    Options options;
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        auto value = [&]() -> std::string {
+            if (i + 1 >= argc) {
+                std::cerr << "Missing value for " << arg << std::endl;
+                std::exit(2);
+            }
+            return argv[++i];
+        };
+        try {
+            if (arg == "--families") {
+                options.families = split(value());
+            } else if (arg == "--min-vertices") {
+                options.minVertices = std::stoi(value());
+            } else if (arg == "--max-vertices") {
+                options.maxVertices = std::stoi(value());
+            } else if (arg == "--repetitions") {
+                options.repetitions = std::max(1, std::stoi(value()));
+            } else if (arg == "--time-limit") {
+                options.timeLimitSeconds = std::stod(value());
+            } else if (arg == "--seed") {
+                options.seed = parseSeed(value());
+            } else if (arg == "--output") {
+                options.output = value();
+            } else {
+                exitWithUsage(arg == "--help" ? 0 : 2);
+            }
+        } catch (const std::logic_error&) {  // std::invalid_argument and std::out_of_range
+            std::cerr << "Invalid value \"" << argv[i] << "\" for " << arg << std::endl;
+            exitWithUsage(2);
+        }
+    }
+    return options;
+}
+
+void runOnce(const std::vector<SkeletonConstruction::Point>& polygon, Result& result) {
+    auto start = Clock::now();
+    SkeletonConstruction::SkeletonBuilder builder(polygon);
+    result.stages["skeleton_builder"].push_back(elapsedMs(start));
+
+    const OneCut::PipelineStats& buildStats = builder.getStats();
+    result.stages["interior_skeleton"].push_back(buildStats.interiorSkeletonMs);
+    result.stages["exterior_skeleton"].push_back(buildStats.exteriorSkeletonMs);
+    result.stages["inner_skeleton_to_faces"].push_back(buildStats.innerFacesMs);
+    result.stages["outer_skeleton_to_faces"].push_back(buildStats.outerFacesMs);
+
+    start = Clock::now();
+    OneCut::StraightSkeleton skeleton = builder.buildSkeleton();
+    result.stages["build_skeleton"].push_back(elapsedMs(start));
+    result.faces = skeleton.faceCount();
+
+    start = Clock::now();
+    OneCut::CompactSkeleton compact = builder.buildCompactSkeleton();
+    result.stages["build_compact_skeleton"].push_back(elapsedMs(start));
+
+    // Exact and fast kernel on the same skeleton; the fast finder setup converts the faces to doubles
+    start = Clock::now();
+    OneCut::PerpendicularFinder exactFinder(skeleton);
+    std::vector<OneCut::PerpChain> chains = exactFinder.findPerpendiculars();
+    result.stages["find_perpendiculars_exact"].push_back(elapsedMs(start));
+    result.chains = chains.size();
+
+    start = Clock::now();
+    OneCut::FastPerpendicularFinder fastFinder(skeleton);
+    fastFinder.findPerpendiculars();
+    result.stages["find_perpendiculars_fast"].push_back(elapsedMs(start));
+
+    start = Clock::now();
+    OneCut::FastPerpendicularFinder compactFinder(compact);
+    compactFinder.findPerpendiculars();
+    result.stages["find_perpendiculars_fast_compact"].push_back(elapsedMs(start));
+
+    // All hardware threads; the chains are identical to the serial run
+    start = Clock::now();
+    OneCut::FastPerpendicularFinder parallelFinder(compact);
+    parallelFinder.setThreadCount(0);
+    parallelFinder.findPerpendiculars();
+    result.stages["find_perpendiculars_fast_parallel"].push_back(elapsedMs(start));
+
+    start = Clock::now();
+    OneCut::FastPerpendicularFinder graphFinder(compact);
+    graphFinder.findPerpendicularGraph();
+    result.stages["find_perpendicular_graph_fast_compact"].push_back(elapsedMs(start));
+
+    OneCut::FoldManager foldManager(polygon);
+    start = Clock::now();
+    std::vector<OneCut::Crease> creases = foldManager.getCreases(result.stats);
+    result.stages["get_creases"].push_back(elapsedMs(start));
+    result.stages["crease_assembly"].push_back(result.stats.creaseAssemblyMs);
+    result.creases = creases.size();
+
+    OneCut::FoldOptions exactOptions;
+    exactOptions.exactKernel = true;
+    OneCut::FoldManager exactManager(polygon, exactOptions);
+    start = Clock::now();
+    exactManager.getCreases();
+    result.stages["get_creases_exact"].push_back(elapsedMs(start));
+
+    // Interior-only preview, including construction since that is where the saving is
+    OneCut::FoldOptions interiorOnly;
+    interiorOnly.interiorOnly = true;
+    start = Clock::now();
+    OneCut::FoldManager previewManager(polygon, interiorOnly);
+    previewManager.getCreases();
+    result.stages["interior_only_total"].push_back(elapsedMs(start));
+}
+
+std::string escape(const std::string& text) {
+    std::string escaped;
+    for (char c : text) {
+        if (c == '"' || c == '\\') {
+            escaped += '\\';
+            escaped += c;
+        } else if (static_cast<unsigned char>(c) < 0x20) {
+            escaped += ' ';
+        } else {
+            escaped += c;
+        }
+    }
+    return escaped;
+}
+
+void writeJson(std::ostream& os, const Options& options, const std::vector<Result>& results) {
+    os << "{\n  \"benchmark\": \"onecut_bench\",\n";
+    os << "  \"repetitions\": " << options.repetitions << ",\n";
+    os << "  \"seed\": " << options.seed << ",\n";
+    os << "  \"unit\": \"ms\",\n";
+    os << "  \"results\": [";
+    for (size_t r = 0; r < results.size(); r++) {
+        const Result& result = results[r];
+        os << (r == 0 ? "\n" : ",\n");
+        os << "    {\"family\": \"" << escape(result.family) << "\", \"vertices\": " << result.vertices
+           << ", \"faces\": " << result.faces << ", \"chains\": " << result.chains
+           << ", \"creases\": " << result.creases;
+        if (!result.error.empty()) {
+            os << ", \"error\": \"" << escape(result.error) << "\"";
+        }
+        const OneCut::PipelineStats& stats = result.stats;
+        os << ", \"counters\": {\"face_vertices\": " << stats.faceVertexCount
+           << ", \"edge_map_misses\": " << stats.edgeMapMisses << ", \"chain_iterations\": " << stats.chainIterations
+           << ", \"invalid_hits\": " << stats.invalidHits
+           << ", \"edge_lookup_failures\": " << stats.edgeLookupFailures
+           << ", \"revisited_edge_points\": " << stats.revisitedEdgePoints
+           << ", \"duplicate_segments\": " << stats.duplicateSegments
+           << ", \"cycle_stops\": " << stats.cycleStops << ", \"chain_budget_stops\": " << stats.chainBudgetStops
+           << ", \"arena_bytes\": " << stats.arenaBytes << "}";
+        os << ", \"stages\": {";
+        bool first = true;
+        for (const auto& [name, samples] : result.stages) {
+            std::vector<double> sorted = samples;
+            std::sort(sorted.begin(), sorted.end());
+            double mean = std::accumulate(sorted.begin(), sorted.end(), 0.0) / sorted.size();
+            os << (first ? "\n" : ",\n");
+            os << "      \"" << name << "\": {\"min\": " << sorted.front()
+               << ", \"median\": " << sorted[sorted.size() / 2] << ", \"mean\": " << mean
+               << ", \"max\": " << sorted.back() << "}";
+            first = false;
+        }
+        os << "\n    }}";
+    }
+    os << "\n  ]\n}\n";
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    Options options = parseOptions(argc, argv);
+    std::vector<Result> results;
+
+    for (const std::string& family : options.families) {
+        for (int size : SIZES) {
+            if (size < options.minVertices || size > options.maxVertices) {
+                continue;
+            }
+
+            Result result;
+            result.family = family;
+            auto familyStart = Clock::now();
+            try {
+                std::vector<SkeletonConstruction::Point> polygon =
+                    OneCut::PolygonGenerator::generate(family, size, options.seed);
+                result.vertices = static_cast<int>(polygon.size());
+                for (int repetition = 0; repetition < options.repetitions; repetition++) {
+                    runOnce(polygon, result);
+                }
+            } catch (const std::exception& e) {
+                result.error = e.what();
+            }
+            double seconds = elapsedMs(familyStart) / 1000.0;
+            std::cerr << family << " n=" << result.vertices << ": " << seconds << " s"
+                      << (result.error.empty() ? "" : " (error: " + result.error + ")") << std::endl;
+            results.push_back(result);
+
+            // Larger polygons of this family would only take longer
+            if (!result.error.empty() || seconds > options.timeLimitSeconds) {
+                break;
+            }
+        }
+    }
+
+    if (options.output.empty()) {
+        writeJson(std::cout, options, results);
+    } else {
+        std::ofstream file(options.output);
+        if (!file) {
+            std::cerr << "Cannot open " << options.output << std::endl;
+            return 1;
+        }
+        writeJson(file, options, results);
+    }
+    return 0;
+}
@@ -2,22 +2,226 @@
 #include <CGAL/Line_2.h>
 #include <CGAL/Point_2.h>
 #include <CGAL/Surface_mesh.h>
+#include <pybind11/numpy.h>
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
 
+#include <algorithm>
+#include <cstdint>
+#include <fstream>
 #include <memory>
+#include <span>
 
+#include "../include/OneCut/CompactSkeleton.h"
 #include "../include/OneCut/Crease.h"
+#include "../include/OneCut/CreaseCache.h"
 #include "../include/OneCut/FoldManager.h"
+#include "../include/OneCut/FoldReader.h"
+#include "../include/OneCut/FoldWriter.h"
 #include "../include/OneCut/PerpendicularFinder.h"
+#include "../include/OneCut/PipelineStats.h"
 #include "../include/OneCut/SkeletonBuilder.h"
 #include "../include/OneCut/StraightSkeleton.h"
 #include "../include/OneCut/StraightSkeletonTypes.h"
+#include "../include/OneCut/Tracer.h"
 
 namespace py = pybind11;
 
 namespace OneCut {
 
+namespace {
+
+/**
+ * @brief Converts a span to a Python list without an intermediate std::vector copy
+ */
+template <class T>
+py::list toList(std::span<const T> values) {
+    py::list list(values.size());
+    for (size_t i = 0; i < values.size(); i++) {
+        list[i] = py::cast(values[i]);
+    }
+    return list;
+}
+
+/// Contiguous float64 array; other layouts and dtypes are converted by NumPy once, on input
+using CoordinateArray = py::array_t<double, py::array::c_style | py::array::forcecast>;
+/// Contiguous int8 array of enum values
+using EnumArray = py::array_t<std::int8_t, py::array::c_style | py::array::forcecast>;
+/// Contiguous int64 array of polygon offsets
+using OffsetArray = py::array_t<std::int64_t, py::array::c_style | py::array::forcecast>;
+
+/**
+ * @brief Reads polygon vertices from rows first to last of an (N, 2) array through the buffer protocol
+ * @throws py::value_error if the array does not have two columns
+ */
+std::vector<SkeletonConstruction::Point> polygonFromArray(const CoordinateArray& coordinates, py::ssize_t first,
+                                                          py::ssize_t last) {
+    if (coordinates.ndim() != 2 || coordinates.shape(1) != 2) {
+        throw py::value_error("Expected an (N, 2) array of vertex coordinates");
+    }
+    const double* data = coordinates.data();
+    std::vector<SkeletonConstruction::Point> polygon;
+    polygon.reserve(last - first);
+    for (py::ssize_t row = first; row < last; row++) {
+        polygon.emplace_back(data[2 * row], data[2 * row + 1]);
+    }
+    return polygon;
+}
+
+/**
+ * @brief Reads one polygon from an (N, 2) array
+ */
+std::vector<SkeletonConstruction::Point> polygonFromArray(const CoordinateArray& coordinates) {
+    return polygonFromArray(coordinates, 0, coordinates.ndim() == 2 ? coordinates.shape(0) : 0);
+}
+
+/**
+ * @brief Reads many polygons from a ragged (V, 2) array; polygon i owns rows offsets[i] to offsets[i + 1] - 1
+ * @throws py::value_error if the offsets are not non-decreasing indices into the coordinate rows
+ */
+std::vector<std::vector<SkeletonConstruction::Point>> polygonsFromArrays(const CoordinateArray& coordinates,
+                                                                        const OffsetArray& offsets) {
+    py::ssize_t rowCount = coordinates.ndim() == 2 ? coordinates.shape(0) : 0;
+    if (offsets.ndim() != 1 || offsets.size() < 1) {
+        throw py::value_error("Expected a 1-dimensional array of polygon count + 1 offsets");
+    }
+    const std::int64_t* offsetData = offsets.data();
+    std::vector<std::vector<SkeletonConstruction::Point>> polygons;
+    polygons.reserve(offsets.size() - 1);
+    for (py::ssize_t i = 0; i + 1 < offsets.size(); i++) {
+        if (offsetData[i] < 0 || offsetData[i] > offsetData[i + 1] || offsetData[i + 1] > rowCount) {
+            throw py::value_error("Polygon offsets must be non-decreasing row indices of the coordinate array");
+        }
+        polygons.push_back(polygonFromArray(coordinates, offsetData[i], offsetData[i + 1]));
+    }
+    return polygons;
+}
+
+/**
+ * @brief Reads shapes given as lists of (N, 2) arrays, the outer boundary followed by the holes
+ * @throws py::value_error if a shape has no outer boundary
+ */
+std::vector<SkeletonConstruction::Polygon_with_holes_2> shapesFromArrays(
+    const std::vector<std::vector<CoordinateArray>>& rings) {
+    std::vector<SkeletonConstruction::Polygon_with_holes_2> shapes;
+    shapes.reserve(rings.size());
+    for (const std::vector<CoordinateArray>& shapeRings : rings) {
+        if (shapeRings.empty()) {
+            throw py::value_error("Every shape needs an outer boundary");
+        }
+        std::vector<SkeletonConstruction::Point> outer = polygonFromArray(shapeRings[0]);
+        SkeletonConstruction::Polygon_with_holes_2 shape(SkeletonConstruction::Polygon_2(outer.begin(), outer.end()));
+        for (size_t i = 1; i < shapeRings.size(); i++) {
+            std::vector<SkeletonConstruction::Point> hole = polygonFromArray(shapeRings[i]);
+            shape.add_hole(SkeletonConstruction::Polygon_2(hole.begin(), hole.end()));
+        }
+        shapes.push_back(shape);
+    }
+    return shapes;
+}
+
+/**
+ * @brief Packs creases into NumPy arrays in one pass, without a Python object per crease
+ * @return Dict with "segments" (N, 2, 2) float64, "fold_type" and "origin" (N,) int8 holding
+ *         the enum values, and "face_index" (N,) int32
+ */
+py::dict creaseArrays(const std::vector<Crease>& creases) {
+    py::ssize_t count = creases.size();
+    py::array_t<double> segments(std::vector<py::ssize_t>{count, 2, 2});
+    py::array_t<std::int8_t> foldTypes(count);
+    py::array_t<std::int8_t> origins(count);
+    py::array_t<std::int32_t> faceIndices(count);
+
+    double* segmentData = segments.mutable_data();
+    std::int8_t* foldTypeData = foldTypes.mutable_data();
+    std::int8_t* originData = origins.mutable_data();
+    std::int32_t* faceIndexData = faceIndices.mutable_data();
+    {
+        // Only the buffers are written, which needs no GIL
+        py::gil_scoped_release release;
+        for (py::ssize_t i = 0; i < count; i++) {
+            const Crease& crease = creases[i];
+            segmentData[4 * i] = CGAL::to_double(crease.edge.first.x());
+            segmentData[4 * i + 1] = CGAL::to_double(crease.edge.first.y());
+            segmentData[4 * i + 2] = CGAL::to_double(crease.edge.second.x());
+            segmentData[4 * i + 3] = CGAL::to_double(crease.edge.second.y());
+            foldTypeData[i] = static_cast<std::int8_t>(crease.foldType);
+            originData[i] = static_cast<std::int8_t>(crease.origin);
+            faceIndexData[i] = crease.faceIndex;
+        }
+    }
+
+    py::dict arrays;
+    arrays["segments"] = segments;
+    arrays["fold_type"] = foldTypes;
+    arrays["origin"] = origins;
+    arrays["face_index"] = faceIndices;
+    return arrays;
+}
+
+/**
+ * @brief Copies an indexed crease pattern into NumPy arrays
+ * @return Dict with "vertices" (V, 2) float64, "edges" (E, 2) int32 vertex indices, "fold_type"
+ *         and "origin" (E,) int8 holding the enum values, and "face_index" (E,) int32
+ */
+py::dict creasePatternArrays(const CreasePattern& pattern) {
+    py::ssize_t vertexCount = pattern.vertexCount();
+    py::ssize_t creaseCount = pattern.creaseCount();
+    py::array_t<double> vertices(std::vector<py::ssize_t>{vertexCount, 2});
+    py::array_t<std::int32_t> edges(std::vector<py::ssize_t>{creaseCount, 2});
+    py::array_t<std::int8_t> foldTypes(creaseCount);
+    py::array_t<std::int8_t> origins(creaseCount);
+    py::array_t<std::int32_t> faceIndices(creaseCount);
+
+    std::copy(pattern.vertexCoordinates.begin(), pattern.vertexCoordinates.end(), vertices.mutable_data());
+    std::copy(pattern.edgeVertices.begin(), pattern.edgeVertices.end(), edges.mutable_data());
+    std::transform(pattern.foldTypes.begin(), pattern.foldTypes.end(), foldTypes.mutable_data(),
+                   [](FoldType foldType) { return static_cast<std::int8_t>(foldType); });
+    std::transform(pattern.origins.begin(), pattern.origins.end(), origins.mutable_data(),
+                   [](Origin origin) { return static_cast<std::int8_t>(origin); });
+    std::copy(pattern.faceIndices.begin(), pattern.faceIndices.end(), faceIndices.mutable_data());
+
+    py::dict arrays;
+    arrays["vertices"] = vertices;
+    arrays["edges"] = edges;
+    arrays["fold_type"] = foldTypes;
+    arrays["origin"] = origins;
+    arrays["face_index"] = faceIndices;
+    return arrays;
+}
+
+/**
+ * @brief Copies a compact skeleton into NumPy arrays
+ * @return Dict with "coordinates" (V, 2) float64, "offsets" (F + 1,) int32 (face i owns rows
+ *         offsets[i] to offsets[i + 1] - 1), "adjacency" and "twin_edges" (V,) int32 and
+ *         "is_outer" (F,) bool
+ */
+py::dict skeletonArrays(const CompactSkeleton& skeleton) {
+    py::ssize_t faceCount = skeleton.faceCount();
+    py::ssize_t vertexCount = skeleton.vertexCount();
+    py::array_t<double> coordinates(std::vector<py::ssize_t>{vertexCount, 2});
+    py::array_t<std::int32_t> offsets(faceCount + 1);
+    py::array_t<std::int32_t> adjacency(vertexCount);
+    py::array_t<std::int32_t> twinEdges(vertexCount);
+    py::array_t<bool> isOuter(faceCount);
+
+    std::copy(skeleton.getCoordinates().begin(), skeleton.getCoordinates().end(), coordinates.mutable_data());
+    std::copy(skeleton.getFaceOffsets().begin(), skeleton.getFaceOffsets().end(), offsets.mutable_data());
+    std::copy(skeleton.getAdjacency().begin(), skeleton.getAdjacency().end(), adjacency.mutable_data());
+    std::copy(skeleton.getTwinEdges().begin(), skeleton.getTwinEdges().end(), twinEdges.mutable_data());
+    std::copy(skeleton.getOuterFlags().begin(), skeleton.getOuterFlags().end(), isOuter.mutable_data());
+
+    py::dict arrays;
+    arrays["coordinates"] = coordinates;
+    arrays["offsets"] = offsets;
+    arrays["adjacency"] = adjacency;
+    arrays["twin_edges"] = twinEdges;
+    arrays["is_outer"] = isOuter;
+    return arrays;
+}
+
+}  // namespace
+
 /**
  * @defgroup pythonBindings Python Bindings
  * @brief Python interface for OneCut origami computation library
@@ -57,6 +261,53 @@ PYBIND11_MODULE(one_cut, m) {
         .def("y", [](const SkeletonConstruction::Point& p) { return CGAL::to_double(p.y()); }, 
              "Get Y coordinate converted to double");
 
+    /**
+     * @class Tracer
+     * @brief Python interface for recording Chrome trace-event spans of crease computations
+     * @ingroup pythonBindings
+     */
+    py::class_<Tracer, std::shared_ptr<Tracer>>(m, "Tracer")
+        .def(py::init<>(), "Empty tracer; event times are relative to its construction")
+        .def("start", [](std::shared_ptr<Tracer> self) { Tracer::install(std::move(self)); },
+             "Record the spans of all following computations in this tracer")
+        .def("stop", [](const Tracer& self) {
+            if (Tracer::active().get() == &self) {
+                Tracer::install(nullptr);
+            }
+        }, "Stop recording")
+        .def("__enter__", [](std::shared_ptr<Tracer> self) {
+            Tracer::install(self);
+            return self;
+        })
+        .def("__exit__", [](const Tracer& self, py::args) {
+            if (Tracer::active().get() == &self) {
+                Tracer::install(nullptr);
+            }
+        })
+        .def_property_readonly("event_count", [](const Tracer& self) { return self.events().size(); },
+                               "Number of recorded spans")
+        .def("clear", &Tracer::clear, "Remove all recorded spans")
+        .def("write", &Tracer::writeFile, py::arg("path"),
+             "Write the spans as Chrome trace-event JSON (chrome://tracing, ui.perfetto.dev)");
+
+    /**
+     * @class Paper
+     * @brief Python interface for the sheet creases are computed on
+     * @ingroup pythonBindings
+     */
+    py::class_<OneCut::Paper>(m, "Paper")
+        .def(py::init<>(), "The default 600 x 600 sheet with its lower left corner at the origin")
+        .def(py::init([](double xMin, double yMin, double xMax, double yMax) {
+            return OneCut::Paper{xMin, yMin, xMax, yMax};
+        }), py::arg("x_min"), py::arg("y_min"), py::arg("x_max"), py::arg("y_max"), "Sheet with the given borders")
+        .def_static("unbounded", &OneCut::Paper::unbounded, "Sheet without borders, which disables all clipping")
+        .def_readwrite("x_min", &OneCut::Paper::xMin, "Left border")
+        .def_readwrite("y_min", &OneCut::Paper::yMin, "Bottom border")
+        .def_readwrite("x_max", &OneCut::Paper::xMax, "Right border")
+        .def_readwrite("y_max", &OneCut::Paper::yMax, "Top border")
+        .def("contains", &OneCut::Paper::contains<double>, py::arg("x"), py::arg("y"),
+             "True if the point lies on the sheet, border included");
+
     /**
      * @class SkeletonBuilder
      * @brief Python interface for building straight skeletons
@@ -65,7 +316,62 @@ PYBIND11_MODULE(one_cut, m) {
     py::class_<SkeletonConstruction::SkeletonBuilder>(m, "SkeletonBuilder")
         .def(py::init<const std::vector<SkeletonConstruction::Point>&>(), 
              py::arg("vertices"), 
-             "Construct from polygon vertices");
+             "Construct from polygon vertices")
+        .def(py::init([](const CoordinateArray& vertices, std::optional<OneCut::Paper> paper) {
+            return std::make_unique<SkeletonConstruction::SkeletonBuilder>(
+                polygonFromArray(vertices), SkeletonConstruction::ExteriorMode::EAGER, paper);
+        }), py::arg("vertices"), py::arg("paper") = std::nullopt,
+             "Construct from an (N, 2) float64 array of polygon vertices; outer faces are clipped to paper if given")
+        .def_static("from_shapes", [](const std::vector<std::vector<CoordinateArray>>& shapes) {
+            return std::make_unique<SkeletonConstruction::SkeletonBuilder>(shapesFromArrays(shapes));
+        }, py::arg("shapes"), "Construct from several shapes, each a list of (N, 2) arrays: "
+           "the outer boundary followed by its holes")
+        .def("build_skeleton", &SkeletonConstruction::SkeletonBuilder::buildSkeleton,
+             "Build the straight skeleton with inner and outer faces")
+        .def("build_skeleton_arrays", [](SkeletonConstruction::SkeletonBuilder& builder) {
+            return skeletonArrays(builder.buildCompactSkeleton());
+        }, "Build the straight skeleton as flat NumPy arrays (coordinates, offsets, adjacency, twin_edges, "
+           "is_outer)");
+
+    /**
+     * @class SkeletonFace
+     * @brief Python interface for one face of a straight skeleton
+     * @ingroup pythonBindings
+     */
+    py::class_<OneCut::SkeletonFace>(m, "SkeletonFace")
+        .def("vertex_count", &OneCut::SkeletonFace::vertexCount, "Number of vertices (and edges) of the face")
+        .def_property_readonly("vertices", [](const OneCut::SkeletonFace& face) {
+            return toList(face.vertexSpan());
+        }, "Vertices of the face in order")
+        .def_property_readonly("adjacent_faces", [](const OneCut::SkeletonFace& face) {
+            return toList(face.adjacentFaceSpan());
+        }, "Index of the face adjacent to each edge, or -1")
+        .def_readonly("is_outer", &OneCut::SkeletonFace::isOuter, "True for faces outside the polygon");
+
+    /**
+     * @class StraightSkeleton
+     * @brief Python interface for a computed straight skeleton
+     * @ingroup pythonBindings
+     */
+    py::class_<OneCut::StraightSkeleton>(m, "StraightSkeleton")
+        .def("face_count", &OneCut::StraightSkeleton::faceCount, "Number of faces")
+        .def("face", [](const OneCut::StraightSkeleton& skeleton, size_t i) -> const OneCut::SkeletonFace& {
+            if (i >= skeleton.faceCount()) {
+                throw py::index_error("face index out of range");
+            }
+            return skeleton.face(i);
+        }, py::arg("index"), py::return_value_policy::reference_internal, "Face by index, without copying")
+        .def_property_readonly("faces", [](py::object self) {
+            std::span<const OneCut::SkeletonFace> faces = self.cast<const OneCut::StraightSkeleton&>().faceSpan();
+            py::list list(faces.size());
+            for (size_t i = 0; i < faces.size(); i++) {
+                list[i] = py::cast(&faces[i], py::return_value_policy::reference_internal, self);
+            }
+            return list;
+        }, "All faces, referencing the skeleton instead of copying it")
+        .def("to_arrays", [](const OneCut::StraightSkeleton& skeleton) {
+            return skeletonArrays(OneCut::CompactSkeleton(skeleton));
+        }, "All faces as flat NumPy arrays (coordinates, offsets, adjacency, twin_edges, is_outer)");
 
     /**
      * @class PerpendicularFinder
@@ -74,8 +380,19 @@ PYBIND11_MODULE(one_cut, m) {
      */
     py::class_<OneCut::PerpendicularFinder>(m, "PerpendicularFinder")
         .def(py::init<OneCut::StraightSkeleton&>(), 
-             py::arg("skeleton"), 
+             py::arg("skeleton"), py::keep_alive<1, 2>(),
              "Construct with computed straight skeleton")
+        .def_property("thread_count", &OneCut::PerpendicularFinder::getThreadCount,
+                      &OneCut::PerpendicularFinder::setThreadCount,
+                      "Threads tracing chains; 1 is serial, 0 uses all hardware threads")
+        .def_property("chain_budget", &OneCut::PerpendicularFinder::getChainBudget,
+                      &OneCut::PerpendicularFinder::setChainBudget, "Iterations per chain, 0 for no limit")
+        .def_property("job_budget", &OneCut::PerpendicularFinder::getJobBudget,
+                      &OneCut::PerpendicularFinder::setJobBudget, "Iterations per call over all chains, 0 for no limit")
+        .def_property("paper", &OneCut::PerpendicularFinder::getPaper, &OneCut::PerpendicularFinder::setPaper,
+                      "Sheet chains start on and stop at")
+        .def_property_readonly("terminations", &OneCut::PerpendicularFinder::getTerminations,
+                               "Why each chain of the last find_perpendiculars() call stopped")
         .def("find_perpendiculars", [](OneCut::PerpendicularFinder& pf) {
             std::vector<std::pair<OneCut::Point, OneCut::Point>> edges;
             std::vector<PerpChain> chains = pf.findPerpendiculars();
@@ -85,7 +402,16 @@ PYBIND11_MODULE(one_cut, m) {
                 }
             }
             return edges;
-        }, "Find all perpendicular fold chains as flattened edge list");
+        }, "Find all perpendicular fold chains as flattened edge list")
+        .def("find_perpendicular_graph", [](OneCut::PerpendicularFinder& pf) {
+            OneCut::PerpGraph graph = pf.findPerpendicularGraph();
+            std::vector<std::pair<int, int>> segments;
+            segments.reserve(graph.segments.size());
+            for (const OneCut::PerpGraphSegment& segment : graph.segments) {
+                segments.emplace_back(segment.start, segment.end);
+            }
+            return std::make_pair(graph.vertices, segments);
+        }, "Find all perpendicular folds as (points, segments), each point and segment listed once");
 
     /**
      * @enum Origin
@@ -109,6 +435,21 @@ PYBIND11_MODULE(one_cut, m) {
         .value("UNFOLDED", OneCut::FoldType::UNFOLDED, "Unfolded crease")
         .export_values();
 
+    /**
+     * @enum ChainTermination
+     * @brief Reason a perpendicular chain stopped
+     * @ingroup pythonBindings
+     */
+    py::enum_<OneCut::ChainTermination>(m, "ChainTermination")
+        .value("BOUNDARY", OneCut::ChainTermination::BOUNDARY, "Crossed an edge without an adjacent face")
+        .value("INVALID_HIT", OneCut::ChainTermination::INVALID_HIT, "No intersection in the current face")
+        .value("EDGE_LOOKUP_FAILED", OneCut::ChainTermination::EDGE_LOOKUP_FAILED,
+               "Crossed edge not found in the adjacent face")
+        .value("CYCLE", OneCut::ChainTermination::CYCLE, "Ran in a loop")
+        .value("CHAIN_BUDGET", OneCut::ChainTermination::CHAIN_BUDGET, "Used up the per-chain budget")
+        .value("JOB_BUDGET", OneCut::ChainTermination::JOB_BUDGET, "The per-call budget was used up")
+        .value("MERGED", OneCut::ChainTermination::MERGED, "Joined a path an earlier chain traced");
+
     /**
      * @class Crease
      * @brief Python interface for fold crease information
@@ -124,6 +465,60 @@ PYBIND11_MODULE(one_cut, m) {
         .def_readonly("isBoundaryEdge", &OneCut::Crease::isBoundaryEdge, 
                      "True if polygon boundary edge");
 
+    /**
+     * @class PipelineStats
+     * @brief Python interface for the instrumentation of a crease computation
+     * @ingroup pythonBindings
+     */
+    py::class_<OneCut::PipelineStats>(m, "PipelineStats")
+        .def(py::init<>())
+        .def_readonly("interior_skeleton_ms", &OneCut::PipelineStats::interiorSkeletonMs)
+        .def_readonly("exterior_skeleton_ms", &OneCut::PipelineStats::exteriorSkeletonMs)
+        .def_readonly("inner_faces_ms", &OneCut::PipelineStats::innerFacesMs)
+        .def_readonly("outer_faces_ms", &OneCut::PipelineStats::outerFacesMs)
+        .def_readonly("perpendiculars_ms", &OneCut::PipelineStats::perpendicularsMs)
+        .def_readonly("crease_assembly_ms", &OneCut::PipelineStats::creaseAssemblyMs)
+        .def_readonly("total_ms", &OneCut::PipelineStats::totalMs)
+        .def_readonly("polygon_vertex_count", &OneCut::PipelineStats::polygonVertexCount)
+        .def_readonly("inner_face_count", &OneCut::PipelineStats::innerFaceCount)
+        .def_readonly("outer_face_count", &OneCut::PipelineStats::outerFaceCount)
+        .def_readonly("face_vertex_count", &OneCut::PipelineStats::faceVertexCount)
+        .def_readonly("edge_map_misses", &OneCut::PipelineStats::edgeMapMisses)
+        .def_readonly("clipped_outer_faces", &OneCut::PipelineStats::clippedOuterFaces)
+        .def_readonly("arena_bytes", &OneCut::PipelineStats::arenaBytes)
+        .def_readonly("chain_count", &OneCut::PipelineStats::chainCount)
+        .def_readonly("chain_iterations", &OneCut::PipelineStats::chainIterations)
+        .def_readonly("invalid_hits", &OneCut::PipelineStats::invalidHits)
+        .def_readonly("edge_lookup_failures", &OneCut::PipelineStats::edgeLookupFailures)
+        .def_readonly("revisited_edge_points", &OneCut::PipelineStats::revisitedEdgePoints)
+        .def_readonly("duplicate_segments", &OneCut::PipelineStats::duplicateSegments)
+        .def_readonly("boundary_stops", &OneCut::PipelineStats::boundaryStops)
+        .def_readonly("cycle_stops", &OneCut::PipelineStats::cycleStops)
+        .def_readonly("chain_budget_stops", &OneCut::PipelineStats::chainBudgetStops)
+        .def_readonly("job_budget_stops", &OneCut::PipelineStats::jobBudgetStops)
+        .def_readonly("crease_count", &OneCut::PipelineStats::creaseCount);
+
+    /**
+     * @class FoldOptions
+     * @brief Python interface for the FoldManager configuration
+     * @ingroup pythonBindings
+     */
+    py::class_<OneCut::FoldOptions>(m, "FoldOptions")
+        .def(py::init<>())
+        .def_readwrite("interior_only", &OneCut::FoldOptions::interiorOnly,
+                       "Only compute creases inside the polygon (skips the exterior skeleton)")
+        .def_readwrite("exact_kernel", &OneCut::FoldOptions::exactKernel,
+                       "Trace perpendiculars with exact constructions instead of doubles (slower)")
+        .def_readwrite("thread_count", &OneCut::FoldOptions::threadCount,
+                       "Threads tracing perpendiculars; 1 is serial, 0 uses all hardware threads")
+        .def_readwrite("chain_budget", &OneCut::FoldOptions::chainBudget,
+                       "Iterations per perpendicular chain, 0 for no limit")
+        .def_readwrite("job_budget", &OneCut::FoldOptions::jobBudget,
+                       "Iterations of all perpendicular chains of a polygon, 0 for no limit")
+        .def_readwrite("paper", &OneCut::FoldOptions::paper,
+                       "Sheet outer faces are clipped to and chains stop at, None (default) for no clipping and "
+                       "no check that the polygon lies on it; Paper.unbounded() disables clipping");
+
     /**
      * @class FoldManager
      * @brief Main entry point for Python fold computation
@@ -133,8 +528,200 @@ PYBIND11_MODULE(one_cut, m) {
         .def(py::init<const std::vector<SkeletonConstruction::Point>&>(), 
              py::arg("vertices"), 
              "Initialize with polygon vertices")
-        .def("get_creases", &OneCut::FoldManager::getCreases, 
-             "Retrieve all computed creases");
+        .def(py::init<const std::vector<SkeletonConstruction::Point>&, const OneCut::FoldOptions&>(),
+             py::arg("vertices"), py::arg("options"),
+             "Initialize with polygon vertices and a FoldOptions configuration")
+        .def(py::init([](const CoordinateArray& vertices, const OneCut::FoldOptions& options) {
+            return std::make_unique<OneCut::FoldManager>(polygonFromArray(vertices), options);
+        }), py::arg("vertices"), py::arg("options") = OneCut::FoldOptions(),
+             "Initialize with an (N, 2) float64 array of polygon vertices and an optional FoldOptions")
+        .def_static("from_shapes", [](const std::vector<std::vector<CoordinateArray>>& shapes,
+                                      const OneCut::FoldOptions& options) {
+            return std::make_unique<OneCut::FoldManager>(shapesFromArrays(shapes), options);
+        }, py::arg("shapes"), py::arg("options") = OneCut::FoldOptions(),
+           "Initialize with several shapes, each a list of (N, 2) arrays: the outer boundary followed by its holes")
+        .def("get_creases", py::overload_cast<>(&OneCut::FoldManager::getCreases), 
+             "Retrieve all computed creases")
+        .def("get_creases_with_stats", [](OneCut::FoldManager& fm) {
+            OneCut::PipelineStats stats;
+            std::vector<OneCut::Crease> creases = fm.getCreases(stats);
+            return std::make_pair(creases, stats);
+        }, "Retrieve all computed creases together with their PipelineStats")
+        .def("get_crease_arrays", [](OneCut::FoldManager& fm) {
+            return creaseArrays(fm.getCreases());
+        }, "Retrieve all creases as NumPy arrays (segments, fold_type, origin, face_index)")
+        .def("get_crease_pattern", [](OneCut::FoldManager& fm, double weldTolerance) {
+            OneCut::CreasePattern pattern;
+            {
+                py::gil_scoped_release release;
+                pattern = fm.getCreasePattern(weldTolerance);
+            }
+            return creasePatternArrays(pattern);
+        }, py::arg("weld_tolerance") = 0.0,
+           "Retrieve all creases as an indexed pattern: welded vertices (V, 2) and vertex index pairs edges (E, 2), "
+           "with fold_type, origin and face_index per edge");
+
+    /**
+     * @class FoldResult
+     * @brief Python interface for the result of one polygon of a batch
+     * @ingroup pythonBindings
+     */
+    py::class_<OneCut::FoldResult>(m, "FoldResult")
+        .def_readonly("creases", &OneCut::FoldResult::creases, "All creases; empty if the computation failed")
+        .def_readonly("stats", &OneCut::FoldResult::stats, "PipelineStats of the computation")
+        .def_readonly("error", &OneCut::FoldResult::error, "Error message, empty on success")
+        .def("ok", &OneCut::FoldResult::ok, "True if the computation succeeded")
+        .def("crease_arrays", [](const OneCut::FoldResult& result) {
+            return creaseArrays(result.creases);
+        }, "The creases as NumPy arrays (segments, fold_type, origin, face_index)");
+
+    /**
+     * @class CacheStats
+     * @brief Python interface for the counters of a CreaseCache
+     * @ingroup pythonBindings
+     */
+    py::class_<OneCut::CacheStats>(m, "CacheStats")
+        .def_readonly("hits", &OneCut::CacheStats::hits)
+        .def_readonly("disk_hits", &OneCut::CacheStats::diskHits)
+        .def_readonly("misses", &OneCut::CacheStats::misses)
+        .def_readonly("evictions", &OneCut::CacheStats::evictions)
+        .def_readonly("disk_writes", &OneCut::CacheStats::diskWrites);
+
+    /**
+     * @class CreaseCache
+     * @brief Python interface for the LRU cache of crease sets
+     * @ingroup pythonBindings
+     */
+    py::class_<OneCut::CreaseCache>(m, "CreaseCache")
+        .def(py::init<size_t, const std::string&>(), py::arg("capacity") = 256, py::arg("directory") = "",
+             "Construct with the number of crease sets kept in memory and an optional directory for the disk tier")
+        .def("get_creases", [](OneCut::CreaseCache& cache, const std::vector<SkeletonConstruction::Point>& vertices,
+                               const OneCut::FoldOptions& options) {
+            py::gil_scoped_release release;
+            return cache.getCreases(vertices, options);
+        }, py::arg("vertices"), py::arg("options") = OneCut::FoldOptions(),
+           "Creases of the polygon, computed only if no equal polygon (up to start vertex and orientation) is cached")
+        .def("get_creases", [](OneCut::CreaseCache& cache, const CoordinateArray& vertices,
+                               const OneCut::FoldOptions& options) {
+            std::vector<SkeletonConstruction::Point> polygon = polygonFromArray(vertices);
+            py::gil_scoped_release release;
+            return cache.getCreases(polygon, options);
+        }, py::arg("vertices"), py::arg("options") = OneCut::FoldOptions(),
+           "Creases of the polygon given as an (N, 2) float64 array")
+        .def("get_crease_arrays", [](OneCut::CreaseCache& cache, const CoordinateArray& vertices,
+                                     const OneCut::FoldOptions& options) {
+            std::vector<SkeletonConstruction::Point> polygon = polygonFromArray(vertices);
+            std::vector<OneCut::Crease> creases;
+            {
+                py::gil_scoped_release release;
+                creases = cache.getCreases(polygon, options);
+            }
+            return creaseArrays(creases);
+        }, py::arg("vertices"), py::arg("options") = OneCut::FoldOptions(),
+           "Creases of the polygon as NumPy arrays (segments, fold_type, origin, face_index)")
+        .def_static("polygon_hash", [](const CoordinateArray& vertices, const OneCut::FoldOptions& options) {
+            return OneCut::CreaseCache::polygonHash(polygonFromArray(vertices), options);
+        }, py::arg("vertices"), py::arg("options") = OneCut::FoldOptions(), "Cache key of a polygon")
+        .def_property_readonly("stats", &OneCut::CreaseCache::getStats, "CacheStats with the hit and miss counters")
+        .def("size", &OneCut::CreaseCache::size, "Number of crease sets held in memory")
+        .def("clear", &OneCut::CreaseCache::clear, "Drop all crease sets held in memory");
+
+    /**
+     * @brief Writes a crease pattern as a FOLD file without building the JSON in Python
+     * @ingroup pythonBindings
+     */
+    m.def("write_fold", [](const std::string& path, const std::vector<SkeletonConstruction::Point>& vertices,
+                           const std::vector<OneCut::Crease>& creases, const std::string& author) {
+        OneCut::FoldFileInfo info;
+        info.author = author;
+        py::gil_scoped_release release;
+        OneCut::FoldWriter(info).writeFile(path, vertices, creases);
+    }, py::arg("path"), py::arg("vertices"), py::arg("creases"), py::arg("author") = "",
+       "Write the polygon and its creases as a FOLD file, welding equal crease end points");
+    m.def("write_fold", [](const std::string& path, const CoordinateArray& vertices, const CoordinateArray& segments,
+                           const EnumArray& foldTypes, const std::string& author) {
+        std::vector<SkeletonConstruction::Point> polygon = polygonFromArray(vertices);
+        OneCut::FoldFileInfo info;
+        info.author = author;
+        std::span<const double> segmentSpan(segments.data(), segments.size());
+        std::span<const std::int8_t> foldTypeSpan(foldTypes.data(), foldTypes.size());
+
+        py::gil_scoped_release release;
+        std::ofstream file(path);
+        if (!file) {
+            throw std::runtime_error("Cannot open " + path);
+        }
+        OneCut::FoldWriter(info).write(file, polygon, segmentSpan, foldTypeSpan);
+        if (!file) {
+            throw std::runtime_error("Cannot write " + path);
+        }
+    }, py::arg("path"), py::arg("vertices"), py::arg("segments"), py::arg("fold_types"), py::arg("author") = "",
+       "Write a FOLD file from an (N, 2) polygon array, (M, 2, 2) crease segments and M FoldType values, "
+       "as returned by get_crease_arrays");
+
+    /**
+     * @class FoldData
+     * @brief Python interface for the geometry read from a FOLD file
+     * @ingroup pythonBindings
+     */
+    py::class_<OneCut::FoldData>(m, "FoldData")
+        .def_property_readonly("vertices_coords", [](const OneCut::FoldData& data) {
+            py::array_t<double> coordinates(std::vector<py::ssize_t>{static_cast<py::ssize_t>(data.vertexCount()), 2});
+            std::copy(data.vertexCoordinates.begin(), data.vertexCoordinates.end(), coordinates.mutable_data());
+            return coordinates;
+        }, "(V, 2) float64 array of vertex coordinates")
+        .def_property_readonly("edges_vertices", [](const OneCut::FoldData& data) {
+            py::ssize_t edgeCount = data.edgeVertices.size() / 2;
+            py::array_t<std::int32_t> edges(std::vector<py::ssize_t>{edgeCount, 2});
+            std::copy(data.edgeVertices.begin(), data.edgeVertices.end(), edges.mutable_data());
+            return edges;
+        }, "(E, 2) int32 array of edge end points")
+        .def_readonly("edges_assignment", &OneCut::FoldData::edgeAssignments,
+                      "One assignment letter (B, M, V, F, U, ...) per edge")
+        .def_readonly("faces_vertices", &OneCut::FoldData::faces, "Vertex indices of every face")
+        .def("boundary_polygons", [](const OneCut::FoldData& data) {
+            py::list polygons;
+            for (const std::vector<SkeletonConstruction::Point>& polygon : data.boundaryPolygons()) {
+                py::array_t<double> coordinates(std::vector<py::ssize_t>{static_cast<py::ssize_t>(polygon.size()), 2});
+                double* coordinateData = coordinates.mutable_data();
+                for (size_t i = 0; i < polygon.size(); i++) {
+                    coordinateData[2 * i] = polygon[i].x();
+                    coordinateData[2 * i + 1] = polygon[i].y();
+                }
+                polygons.append(coordinates);
+            }
+            return polygons;
+        }, "Polygons bounded by the B edges as (N, 2) float64 arrays, ready for FoldManager");
+
+    /**
+     * @brief Reads the geometry of a FOLD file without building the JSON in Python
+     * @ingroup pythonBindings
+     */
+    m.def("read_fold", [](const std::string& path) {
+        py::gil_scoped_release release;
+        return OneCut::FoldReader::read(path);
+    }, py::arg("path"), "Read vertices, edges, assignments and faces of the top-level frame of a FOLD file");
+
+    /**
+     * @brief Computes the creases of many polygons on all cores
+     * @ingroup pythonBindings
+     */
+    m.def("compute_batch", [](const std::vector<std::vector<SkeletonConstruction::Point>>& polygons,
+                              const OneCut::FoldOptions& options, int threadCount) {
+        // The polygons are converted before and the results after, so only the computation runs without the GIL
+        py::gil_scoped_release release;
+        return OneCut::FoldManager::computeBatch(polygons, options, threadCount);
+    }, py::arg("polygons"), py::arg("options") = OneCut::FoldOptions(), py::arg("thread_count") = 0,
+       "Compute the creases of many polygons concurrently; returns one FoldResult per polygon, in order");
+    m.def("compute_batch", [](const CoordinateArray& coordinates, const OffsetArray& offsets,
+                              const OneCut::FoldOptions& options, int threadCount) {
+        std::vector<std::vector<SkeletonConstruction::Point>> polygons = polygonsFromArrays(coordinates, offsets);
+        py::gil_scoped_release release;
+        return OneCut::FoldManager::computeBatch(polygons, options, threadCount);
+    }, py::arg("coordinates"), py::arg("offsets"), py::arg("options") = OneCut::FoldOptions(),
+       py::arg("thread_count") = 0,
+       "Compute the creases of the polygons in a ragged (V, 2) float64 array; polygon i owns rows "
+       "offsets[i] to offsets[i + 1] - 1");
 }
 
 }  // namespace OneCut
\ No newline at end of file
@@ -0,0 +1,123 @@
+#pragma once
+
+#include <cstddef>
+#include <memory_resource>
+
+namespace OneCut {
+
+/**
+ * @class Arena
+ * @brief Monotonic memory resource holding the allocations of one computation.
+ *
+ * Memory is taken from the heap in growing blocks and handed out by bumping a pointer.
+ * Deallocation does nothing; all blocks are returned at once when the arena is destroyed,
+ * so the many small nodes of a skeleton construction neither cost a heap call each nor
+ * fragment the heap of long-running batch workers. Not thread-safe.
+ */
+class Arena : public std::pmr::memory_resource {
+   public:
+    /// Size of the first block taken from the heap
+    static constexpr size_t DEFAULT_INITIAL_SIZE = 64 * 1024;
+
+    /**
+     * @brief Constructs an empty arena.
+     * @param initialSize Size of the first block; later blocks grow geometrically
+     */
+    explicit Arena(size_t initialSize = DEFAULT_INITIAL_SIZE);
+
+    Arena(const Arena&) = delete;
+    Arena& operator=(const Arena&) = delete;
+
+    /**
+     * @brief Gets the number of bytes handed out so far.
+     * @return Sum of all allocation sizes, without alignment padding
+     */
+    size_t bytesAllocated() const;
+
+   private:
+    std::pmr::monotonic_buffer_resource buffer;  ///< Block list and bump pointer
+    size_t allocated = 0;                        ///< Bytes handed out
+
+    void* do_allocate(size_t bytes, size_t alignment) override;
+    void do_deallocate(void* p, size_t bytes, size_t alignment) override;
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override;
+};
+
+/**
+ * @class ArenaScope
+ * @brief Makes a memory resource the default of every ArenaAllocator created on this thread while it lives.
+ *
+ * Scopes nest; the destructor restores the resource of the enclosing scope.
+ */
+class ArenaScope {
+   public:
+    /**
+     * @brief Enters the scope.
+     * @param resource The resource default-constructed ArenaAllocators allocate from
+     */
+    explicit ArenaScope(std::pmr::memory_resource* resource);
+
+    ~ArenaScope();
+
+    ArenaScope(const ArenaScope&) = delete;
+    ArenaScope& operator=(const ArenaScope&) = delete;
+
+    /**
+     * @brief Gets the resource of the innermost scope on this thread.
+     * @return The resource, or the heap (std::pmr::new_delete_resource()) outside of any scope
+     */
+    static std::pmr::memory_resource* current();
+
+   private:
+    std::pmr::memory_resource* previous;  ///< Resource of the enclosing scope, nullptr if none
+};
+
+/**
+ * @class ArenaAllocator
+ * @brief Allocator bound to the resource that was current when it was default-constructed.
+ * @tparam T Type of the allocated objects
+ *
+ * Containers that default-construct their allocator internally, like the halfedge data
+ * structure of CGAL::Straight_skeleton_2, thereby allocate from the arena of the ArenaScope
+ * they were created in, and keep doing so after the scope has ended. Copies and rebound
+ * allocators share the resource.
+ */
+template <class T>
+class ArenaAllocator {
+   public:
+    using value_type = T;
+
+    template <class U>
+    struct rebind {
+        using other = ArenaAllocator<U>;
+    };
+
+    ArenaAllocator() noexcept : resource(ArenaScope::current()) {}
+
+    template <class U>
+    ArenaAllocator(const ArenaAllocator<U>& other) noexcept : resource(other.memoryResource()) {}
+
+    T* allocate(size_t n) { return static_cast<T*>(resource->allocate(n * sizeof(T), alignof(T))); }
+
+    void deallocate(T* p, size_t n) noexcept { resource->deallocate(p, n * sizeof(T), alignof(T)); }
+
+    /**
+     * @brief Gets the resource this allocator draws from.
+     */
+    std::pmr::memory_resource* memoryResource() const noexcept { return resource; }
+
+    template <class U>
+    bool operator==(const ArenaAllocator<U>& other) const noexcept {
+        return resource == other.memoryResource();
+    }
+
+    template <class U>
+    bool operator!=(const ArenaAllocator<U>& other) const noexcept {
+        return resource != other.memoryResource();
+    }
+
+   private:
+    std::pmr::memory_resource* resource;  ///< Source of all allocations
+};
+
+}  // namespace OneCut
@@ -0,0 +1,194 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "ISkeletonFace.h"
+#include "IStraightSkeleton.h"
+#include "SkeletonFace.h"
+#include "StraightSkeletonTypes.h"
+
+namespace OneCut {
+
+class CompactSkeleton;
+
+/**
+ * @class CompactFace
+ * @brief Lightweight view of one face of a CompactSkeleton.
+ *
+ * Owns no data; all accessors read the flat arrays of the skeleton it belongs to.
+ * Exact points are only constructed when vertex() or getVertices() is called.
+ */
+class CompactFace : public ISkeletonFace {
+public:
+    /**
+     * @brief Constructs a view of a face.
+     * @param skeleton The skeleton owning the face data
+     * @param index Index of the face in the skeleton
+     */
+    CompactFace(const CompactSkeleton* skeleton, int index);
+
+    /// @name ISkeletonFace Interface Implementation
+    /// @{
+    size_t vertexCount() const override;
+    Point vertex(size_t i) const override;
+    std::vector<Point> getVertices() const override;
+    std::vector<int> getAdjacentFaces() const override;
+    std::span<const int> adjacentFaceSpan() const override;
+    std::span<const int> twinEdgeSpan() const override;
+    int adjacentFaceIndex(int i) const override;
+    std::ostream& print(std::ostream& os) const override;
+    /// @}
+
+    /**
+     * @brief Gets the x coordinate of a vertex without constructing an exact point.
+     * @param i Index of the vertex (0 <= i < vertexCount())
+     * @return The x coordinate
+     */
+    double x(size_t i) const;
+
+    /**
+     * @brief Gets the y coordinate of a vertex without constructing an exact point.
+     * @param i Index of the vertex (0 <= i < vertexCount())
+     * @return The y coordinate
+     */
+    double y(size_t i) const;
+
+    /**
+     * @brief Gets the coordinates of all vertices without copying them.
+     * @return View of the interleaved x and y coordinates (2 * vertexCount() values)
+     */
+    std::span<const double> coordinateSpan() const;
+
+    /**
+     * @brief Checks whether the face belongs to the outer skeleton.
+     * @return True for outer faces
+     */
+    bool isOuter() const;
+
+private:
+    friend class CompactSkeleton;
+
+    const CompactSkeleton* skeleton; ///< Skeleton owning the face data
+    int index;                       ///< Index of the face in the skeleton
+};
+
+/**
+ * @class CompactSkeleton
+ * @brief Implementation of IStraightSkeleton storing all faces in flat arrays.
+ *
+ * The faces are stored in compressed sparse row form: the vertices of face i are the
+ * entries faceOffsets[i] to faceOffsets[i + 1] - 1 of the contiguous coordinate,
+ * adjacency and twin edge arrays. Compared to a StraightSkeleton, this needs no allocation per face and
+ * keeps coordinates as doubles, which is lossless for skeletons computed with an inexact
+ * construction kernel.
+ */
+class CompactSkeleton : public IStraightSkeleton {
+public:
+    /**
+     * @brief Constructs an empty skeleton.
+     */
+    CompactSkeleton();
+
+    /**
+     * @brief Constructs a compact copy of any skeleton.
+     * @param skeleton The skeleton to copy; coordinates are rounded to doubles
+     */
+    explicit CompactSkeleton(const IStraightSkeleton& skeleton);
+
+    CompactSkeleton(const CompactSkeleton& other);
+    CompactSkeleton(CompactSkeleton&& other) noexcept;
+    CompactSkeleton& operator=(const CompactSkeleton& other);
+    CompactSkeleton& operator=(CompactSkeleton&& other) noexcept;
+
+    /// @name IStraightSkeleton Interface Implementation
+    /// @{
+    size_t faceCount() const override;
+    const CompactFace& face(size_t i) const override;
+    /// @}
+
+    /// @name Construction
+    /// @{
+    /**
+     * @brief Reserves memory for the given number of faces and vertices.
+     * @param faceCapacity Expected number of faces
+     * @param vertexCapacity Expected number of vertices summed over all faces
+     */
+    void reserve(size_t faceCapacity, size_t vertexCapacity);
+
+    /**
+     * @brief Appends a vertex to the face currently being built.
+     * @param x X coordinate of the vertex
+     * @param y Y coordinate of the vertex
+     * @param adjacentFace Index of the face adjacent to the edge starting at this vertex, or -1
+     * @param twinEdge Index of that edge in the adjacent face, or -1 if unknown
+     */
+    void addVertex(double x, double y, int adjacentFace, int twinEdge = -1);
+
+    /**
+     * @brief Finishes the face currently being built; following vertices start a new face.
+     * @param isOuter True if the face belongs to the outer skeleton
+     */
+    void closeFace(bool isOuter);
+
+    /**
+     * @brief Appends all faces of another compact skeleton.
+     * @param other The faces to append; adjacency indices are copied unchanged
+     */
+    void append(const CompactSkeleton& other);
+
+    /**
+     * @brief Changes the adjacency of one edge.
+     * @param faceIndex Index of the face
+     * @param edgeIndex Index of the edge within the face
+     * @param adjacentFace New index of the adjacent face
+     */
+    void setAdjacentFaceIndex(int faceIndex, int edgeIndex, int adjacentFace);
+
+    /**
+     * @brief Changes the twin of one edge.
+     * @param faceIndex Index of the face
+     * @param edgeIndex Index of the edge within the face
+     * @param twinEdge Index of the edge within the adjacent face, or -1
+     */
+    void setTwinEdgeIndex(int faceIndex, int edgeIndex, int twinEdge);
+    /// @}
+
+    /**
+     * @brief Gets the total number of vertices summed over all faces.
+     * @return Length of the coordinate (divided by two) and adjacency arrays
+     */
+    size_t vertexCount() const;
+
+    /**
+     * @brief Materializes the faces as SkeletonFace objects with exact points.
+     * @return One SkeletonFace per face, in index order
+     */
+    std::vector<SkeletonFace> toFaces() const;
+
+    /// @name Raw Arrays
+    /// @{
+    const std::vector<int>& getFaceOffsets() const;        ///< faceCount() + 1 offsets into the vertex arrays
+    const std::vector<double>& getCoordinates() const;     ///< Interleaved x and y of all vertices
+    const std::vector<int>& getAdjacency() const;          ///< Adjacent face of the edge starting at each vertex
+    const std::vector<int>& getTwinEdges() const;          ///< Index of each edge in its adjacent face
+    const std::vector<std::uint8_t>& getOuterFlags() const;  ///< 1 for outer faces, 0 for inner faces
+    /// @}
+
+private:
+    friend class CompactFace;
+
+    std::vector<int> faceOffsets;          ///< Start of every face in the vertex arrays, plus the total count
+    std::vector<double> coordinates;       ///< Interleaved x and y coordinates
+    std::vector<int> adjacency;            ///< Adjacent face per edge
+    std::vector<int> twinEdges;            ///< Twin edge index per edge
+    std::vector<std::uint8_t> outerFlags;  ///< Outer flag per face
+    std::vector<CompactFace> faces;        ///< Views handed out by face()
+
+    /**
+     * @brief Points all face views at this object (after construction, copy or move).
+     */
+    void bindFaces();
+};
+
+}  // namespace OneCut
@@ -47,9 +47,9 @@ struct Crease {
     std::pair<Point, Point> edge; /**< @brief Line segment representing the crease's geometry. */
     FoldType foldType;            /**< @brief Fold direction (mountain, valley, or unfolded). */
     Origin origin;                /**< @brief Origin of the crease (polygon, skeleton, etc.). */
-    int faceIndex;                /**< @brief Index of the associated face in the skeleton. */
-    int edgeIndex;                /**< @brief Index of the edge within its face. */
-    bool isBoundaryEdge;          /**< @brief True if the crease is part of the polygon's boundary. */
+    int faceIndex = -1;           /**< @brief Index of the associated face in the skeleton, or -1. */
+    int edgeIndex = -1;           /**< @brief Index of the edge within its face, or -1. */
+    bool isBoundaryEdge = false;  /**< @brief True if the crease is part of the polygon's boundary. */
 };
 
 }  // namespace OneCut
\ No newline at end of file
@@ -0,0 +1,137 @@
+#pragma once
+
+#include <cstdint>
+#include <list>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "Crease.h"
+#include "FoldManager.h"
+#include "SkeletonBuilder.h"
+
+namespace OneCut {
+
+/**
+ * @struct CacheStats
+ * @brief Hit and miss counters of a CreaseCache.
+ */
+struct CacheStats {
+    size_t hits = 0;        ///< Requests answered from memory
+    size_t diskHits = 0;    ///< Requests answered from the disk tier (also counted as misses of the memory tier)
+    size_t misses = 0;      ///< Requests that had to run a FoldManager
+    size_t evictions = 0;   ///< Entries dropped from memory because the capacity was reached
+    size_t diskWrites = 0;  ///< Entries written to the disk tier
+};
+
+/**
+ * @class CreaseCache
+ * @brief Bounded LRU cache of crease sets, keyed by the canonical form of the polygon.
+ *
+ * The key is computed from the vertex ring after rotating it to start at its smallest
+ * vertex and orienting it counter-clockwise, so polygons differing only in their start
+ * vertex or orientation share an entry. The options that change the result (interiorOnly,
+ * exactKernel, the tracing budgets and the paper) are part of the key; threadCount is not,
+ * since the creases do not depend on it, with or without a job budget.
+ * A hit returns the stored creases without building a skeleton. Crease order and face
+ * indices are those of the first computation.
+ *
+ * With a directory set, every computed crease set is also written there, one file per key,
+ * and looked up there before computing. The files store coordinates as doubles, which is
+ * lossless except for perpendiculars traced with FoldOptions::exactKernel.
+ *
+ * All methods are thread-safe. Computations run outside the lock, so concurrent misses
+ * of the same polygon compute it more than once.
+ */
+class CreaseCache {
+   public:
+    /**
+     * @brief Constructs an empty cache.
+     * @param capacity Maximum number of crease sets kept in memory (at least 1)
+     * @param directory Directory of the persistent tier; empty to keep the cache in memory only.
+     *                  It is created if it does not exist.
+     */
+    explicit CreaseCache(size_t capacity = 256, const std::string& directory = "");
+
+    /**
+     * @brief Gets the creases of a polygon, computing them on a miss.
+     * @param polygon The input polygon
+     * @param options Configuration of the computation
+     * @return The creases, as FoldManager::getCreases() returns them
+     */
+    std::vector<Crease> getCreases(const std::vector<SkeletonConstruction::Point>& polygon,
+                                   const FoldOptions& options = FoldOptions());
+
+    /**
+     * @brief Computes the cache key of a polygon.
+     * @param polygon The input polygon
+     * @param options Configuration of the computation
+     * @return 64-bit hash of the canonical vertex ring and the result-relevant options
+     */
+    static std::uint64_t polygonHash(const std::vector<SkeletonConstruction::Point>& polygon,
+                                     const FoldOptions& options = FoldOptions());
+
+    /**
+     * @brief Gets the hit and miss counters.
+     * @return A copy of the counters
+     */
+    CacheStats getStats() const;
+
+    /**
+     * @brief Gets the number of crease sets held in memory.
+     * @return At most the capacity
+     */
+    size_t size() const;
+
+    /**
+     * @brief Drops all crease sets held in memory; the disk tier is kept.
+     */
+    void clear();
+
+   private:
+    /**
+     * @struct Entry
+     * @brief One cached crease set together with the input it was computed for.
+     */
+    struct Entry {
+        std::uint64_t key;                  ///< polygonHash() of the input
+        std::vector<double> canonicalRing;  ///< Canonical vertex ring, to rule out hash collisions
+        std::vector<std::uint8_t> options;  ///< Result-relevant options, serialized
+        std::vector<Crease> creases;        ///< The cached creases
+    };
+
+    size_t capacity;                                                     ///< Maximum number of entries
+    std::string directory;                                               ///< Disk tier, empty if disabled
+    std::list<Entry> entries;                                            ///< Entries, most recently used first
+    std::unordered_map<std::uint64_t, std::list<Entry>::iterator> index; ///< Key to position in entries
+    CacheStats stats;                                                    ///< Counters
+    mutable std::mutex mutex;                                            ///< Guards all members above
+
+    /**
+     * @brief Inserts an entry as most recently used, evicting the least recently used ones.
+     * @pre The mutex is held
+     */
+    void insert(Entry entry);
+
+    /**
+     * @brief Gets the file of a key in the disk tier.
+     */
+    std::string entryPath(std::uint64_t key) const;
+
+    /**
+     * @brief Reads an entry from the disk tier.
+     * @param path The file to read
+     * @param entry Holds the key, ring and options to match; receives the creases
+     * @return False if the file is missing, unreadable or stores another polygon
+     */
+    static bool readEntry(const std::string& path, Entry& entry);
+
+    /**
+     * @brief Writes an entry to the disk tier, replacing the file atomically.
+     * @return False if the file could not be written
+     */
+    static bool writeEntry(const std::string& path, const Entry& entry);
+};
+
+}  // namespace OneCut
@@ -0,0 +1,93 @@
+#pragma once
+
+#include <vector>
+
+#include "Crease.h"
+#include "utils/WeldGrid.h"
+
+namespace OneCut {
+
+/**
+ * @struct CreasePattern
+ * @brief Creases as an indexed graph: a table of distinct vertices and one vertex index pair per crease.
+ *
+ * Crease i runs from vertex edgeVertices[2 * i] to vertex edgeVertices[2 * i + 1]. Shared end
+ * points are stored once, so the pattern needs a fraction of the memory of the equivalent
+ * Crease list and can be handed to exporters and renderers as it is.
+ */
+struct CreasePattern {
+    std::vector<double> vertexCoordinates;  ///< Interleaved x and y of every vertex
+    std::vector<int> edgeVertices;          ///< Two vertex indices per crease
+    std::vector<FoldType> foldTypes;        ///< Fold direction per crease
+    std::vector<Origin> origins;            ///< Origin per crease
+    std::vector<int> faceIndices;           ///< Skeleton face per crease, -1 if none
+
+    /**
+     * @brief Gets the number of vertices.
+     * @return Half the length of vertexCoordinates
+     */
+    size_t vertexCount() const { return vertexCoordinates.size() / 2; }
+
+    /**
+     * @brief Gets the number of creases.
+     * @return Length of foldTypes
+     */
+    size_t creaseCount() const { return foldTypes.size(); }
+};
+
+/**
+ * @class CreasePatternBuilder
+ * @brief Assembles a CreasePattern, welding end points as they are added.
+ *
+ * Vertices are welded with a WeldGrid: a vertex within the tolerance of an earlier one gets
+ * the index of the nearest such vertex, which keeps its coordinates. With a weld tolerance
+ * of 0 only vertices with equal coordinates are welded.
+ */
+class CreasePatternBuilder {
+   public:
+    /**
+     * @brief Constructs an empty builder.
+     * @param weldTolerance Largest distance of welded vertices, 0 to weld equal coordinates only
+     */
+    explicit CreasePatternBuilder(double weldTolerance = 0);
+
+    /**
+     * @brief Adds a vertex or finds the vertex it is welded to.
+     * @return Index of the vertex in the pattern
+     */
+    int addVertex(double x, double y);
+
+    /**
+     * @brief Adds a vertex given as a point of any kernel.
+     * @return Index of the vertex in the pattern
+     */
+    template <class Point2>
+    int addVertex(const Point2& point) {
+        return addVertex(CGAL::to_double(point.x()), CGAL::to_double(point.y()));
+    }
+
+    /**
+     * @brief Adds a crease between two vertices; creases whose end points were welded together are dropped.
+     * @return False if the crease was dropped
+     */
+    bool addCrease(int start, int end, FoldType foldType, Origin origin, int faceIndex = -1);
+
+    /**
+     * @brief Hands out the assembled pattern and resets the builder.
+     */
+    CreasePattern build();
+
+    /**
+     * @brief Welds a list of creases.
+     * @param creases The creases, e.g. from FoldManager::getCreases()
+     * @param weldTolerance Largest distance of welded vertices, 0 to weld equal coordinates only
+     * @return The creases in the same order, minus those that collapse to a single vertex
+     */
+    static CreasePattern fromCreases(const std::vector<Crease>& creases, double weldTolerance = 0);
+
+   private:
+    CreasePattern pattern;  ///< The pattern assembled so far
+    WeldGrid weld;          ///< Vertex index of every welded point
+};
+
+}  // namespace OneCut
@@ -0,0 +1,66 @@
+#pragma once
+
+#include <functional>
+#include <sstream>
+#include <string>
+
+namespace OneCut {
+
+/**
+ * @typedef DiagnosticSink
+ * @brief Receives diagnostic messages of the library, one line per call.
+ */
+using DiagnosticSink = std::function<void(const std::string&)>;
+
+/**
+ * @class Diagnostics
+ * @brief Process-wide, optional destination for diagnostic messages.
+ *
+ * Messages are only produced when the library is compiled with ONECUT_ENABLE_DIAGNOSTICS
+ * (CMake option ONECUT_DIAGNOSTICS) and a sink is installed. Otherwise the
+ * ONECUT_DIAGNOSTIC macro expands to nothing and costs nothing.
+ */
+class Diagnostics {
+   public:
+    /**
+     * @brief Installs the sink receiving all diagnostic messages.
+     * @param sink The new sink; an empty function removes the current sink
+     */
+    static void setSink(DiagnosticSink sink);
+
+    /**
+     * @brief Checks whether a sink is installed.
+     * @return True if messages are currently delivered somewhere
+     */
+    static bool hasSink();
+
+    /**
+     * @brief Delivers a message to the installed sink, if any.
+     * @param message The message without trailing newline
+     */
+    static void emit(const std::string& message);
+};
+
+}  // namespace OneCut
+
+/**
+ * @def ONECUT_DIAGNOSTIC(streamExpression)
+ * @brief Formats a message with operator<< and hands it to the diagnostic sink.
+ *
+ * Usage: ONECUT_DIAGNOSTIC("Edge not found: " << start << " " << end);
+ * The expression is not evaluated unless diagnostics are compiled in and a sink is set.
+ */
+#ifdef ONECUT_ENABLE_DIAGNOSTICS
+#define ONECUT_DIAGNOSTIC(streamExpression)                      \
+    do {                                                         \
+        if (::OneCut::Diagnostics::hasSink()) {                  \
+            std::ostringstream diagnosticStream;                 \
+            diagnosticStream << streamExpression;                \
+            ::OneCut::Diagnostics::emit(diagnosticStream.str()); \
+        }                                                        \
+    } while (false)
+#else
+#define ONECUT_DIAGNOSTIC(streamExpression) \
+    do {                                    \
+    } while (false)
+#endif
@@ -1,18 +1,97 @@
 #pragma once
 
 #include <cmath>
+#include <optional>
+#include <string>
 #include <utility>
 #include <vector>
 
+#include "CompactSkeleton.h"
 #include "Crease.h"
+#include "CreasePattern.h"
 #include "PerpendicularFinder.h"
+#include "PipelineStats.h"
 #include "SkeletonBuilder.h"
-#include "StraightSkeleton.h"
 #include "StraightSkeletonTypes.h"
 #include "utils/GeometryUtil.h"
 
 namespace OneCut {
 
+/**
+ * @struct FoldOptions
+ * @brief Configuration of the crease computation done by a FoldManager.
+ */
+struct FoldOptions {
+    /**
+     * @brief Only compute creases inside the polygon.
+     *
+     * The exterior straight skeleton is never constructed, which makes this mode suitable
+     * for previews and for jobs that only need interior creases. Perpendiculars stop at
+     * the polygon boundary.
+     */
+    bool interiorOnly = false;
+
+    /**
+     * @brief Trace perpendiculars and classify folds with the exact kernel.
+     *
+     * By default the perpendicular chains are traced with FastKernel, since every
+     * intersection is rounded to double anyway. The exact kernel is much slower; its
+     * results differ only in floating-point rounding.
+     */
+    bool exactKernel = false;
+
+    /**
+     * @brief Number of threads tracing perpendicular chains.
+     *
+     * 1 traces serially, 0 uses all hardware threads. The creases do not depend on it;
+     * with a jobBudget the chains are always traced serially to keep it that way.
+     */
+    int threadCount = 1;
+
+    /**
+     * @brief Iterations a single perpendicular chain may take, 0 for no limit.
+     *
+     * Chains running in a loop are stopped by cycle detection regardless of this budget.
+     */
+    int chainBudget = PerpendicularFinder::MAX_ITERATIONS;
+
+    /**
+     * @brief Iterations all perpendicular chains of one polygon may take together, 0 for no limit.
+     *
+     * Bounds the tracing time of pathological inputs. Chains still running when it is used up
+     * are cut short, which PipelineStats::jobBudgetStops reports. The budget is charged in seed
+     * order on a single thread, so the creases do not depend on threadCount.
+     */
+    size_t jobBudget = 0;
+
+    /**
+     * @brief Sheet the creases are computed for, if set.
+     *
+     * Outer skeleton faces are clipped to it and perpendicular chains stop at its border, so
+     * no work is spent off the sheet. The polygon has to lie on it, otherwise the FoldManager
+     * constructor throws std::invalid_argument. Paper::unbounded() keeps the whole exterior skeleton.
+     * Without a paper the skeleton is not clipped and any polygon is accepted; chains only start on
+     * the default 600 x 600 Paper(), as the perpendicular search always did.
+     */
+    std::optional<Paper> paper;
+};
+
+/**
+ * @struct FoldResult
+ * @brief Outcome of the crease computation of one polygon of a batch.
+ */
+struct FoldResult {
+    std::vector<Crease> creases;  ///< All creases of the polygon; empty if the computation failed
+    PipelineStats stats;          ///< Instrumentation of the computation
+    std::string error;            ///< Message of the exception that aborted the computation, empty on success
+
+    /**
+     * @brief Checks whether the computation succeeded.
+     * @return True if no error occurred
+     */
+    bool ok() const { return error.empty(); }
+};
+
 /**
  * @class FoldManager
  * @brief Manages the generation and processing of creases for one-cut origami folding.
@@ -25,8 +104,19 @@ class FoldManager {
     /**
      * @brief Constructs a FoldManager for the given polygon.
      * @param polygon The input polygon represented as a vector of points.
+     * @param options Configuration of the computation.
+     * @throws std::invalid_argument If options.paper is set and a polygon vertex lies off it
      */
-    FoldManager(const std::vector<SkeletonConstruction::Point>& polygon);
+    FoldManager(const std::vector<SkeletonConstruction::Point>& polygon, const FoldOptions& options = FoldOptions());
+
+    /**
+     * @brief Constructs a FoldManager for a drawing of several shapes with holes.
+     * @param shapes Disjoint shapes; one skeleton and one perpendicular search cover all of them.
+     * @param options Configuration of the computation.
+     * @throws std::invalid_argument If options.paper is set and a ring vertex lies off it
+     */
+    FoldManager(const std::vector<SkeletonConstruction::Polygon_with_holes_2>& shapes,
+                const FoldOptions& options = FoldOptions());
 
     /**
      * @brief Retrieves all creases computed by the FoldManager.
@@ -37,10 +127,81 @@ class FoldManager {
      */
     std::vector<Crease> getCreases();
 
+    /**
+     * @brief Retrieves all creases together with the instrumentation of their computation.
+     * @param stats Overwritten with the stage durations and counters of the skeleton
+     *              construction, the perpendicular search and the crease assembly
+     * @return The same creases as getCreases()
+     */
+    std::vector<Crease> getCreases(PipelineStats& stats);
+
+    /**
+     * @brief Retrieves all creases in indexed form.
+     * @param weldTolerance Crease end points in the same cell of a grid with this spacing share a
+     *                      vertex; 0 welds equal coordinates only
+     * @return The creases of getCreases(), in the same order, with welded end points
+     *
+     * The creases are added to the pattern as they are computed, so no Crease list is built.
+     */
+    CreasePattern getCreasePattern(double weldTolerance = 0);
+
+    /**
+     * @brief Retrieves all creases in indexed form together with the instrumentation of their computation.
+     * @param stats Overwritten as by getCreases(PipelineStats&)
+     * @param weldTolerance As for getCreasePattern(double)
+     * @return The same pattern as getCreasePattern(double)
+     */
+    CreasePattern getCreasePattern(PipelineStats& stats, double weldTolerance = 0);
+
+    /**
+     * @brief Computes the creases of many polygons concurrently.
+     * @param polygons The input polygons
+     * @param options Configuration applied to every polygon; its threadCount is used per
+     *                polygon on top of the batch threads, so keep it at 1 for large batches
+     * @param threadCount Number of polygons computed at the same time, 0 for all hardware threads
+     * @return One result per polygon, in input order
+     *
+     * Every polygon is computed by its own FoldManager. An exception thrown for one polygon
+     * is stored in its FoldResult::error and does not affect the others.
+     */
+    static std::vector<FoldResult> computeBatch(const std::vector<std::vector<SkeletonConstruction::Point>>& polygons,
+                                                const FoldOptions& options = FoldOptions(), int threadCount = 0);
+
    private:
+    FoldOptions options;                           ///< Configuration of the computation
     SkeletonConstruction::SkeletonBuilder skeletonBuilder; ///< Builder for computing the straight skeleton
-    StraightSkeleton skeleton;                     ///< Computed straight skeleton structure
-    PerpendicularFinder perpendicularFinder;       ///< Finds perpendicular folds in the skeleton
+    CompactSkeleton skeleton;                      ///< Computed straight skeleton, kept in flat arrays
+
+    /**
+     * @brief Traces the perpendicular graph in the given kernel with the tracing options.
+     * @param stats Receives the perpendicular timing and counters
+     * @return Perpendicular graph of the skeleton
+     */
+    template <class Kernel>
+    BasicPerpGraph<Kernel> perpendicularGraph(PipelineStats& stats) const;
+
+    /**
+     * @brief Traces the perpendiculars in the given kernel and appends them as valley creases.
+     * @param creases Receives the perpendicular creases
+     * @param stats Receives the perpendicular timing and counters
+     */
+    template <class Kernel>
+    void addPerpendicularCreases(std::vector<Crease>& creases, PipelineStats& stats) const;
+
+    /**
+     * @brief Traces the perpendiculars in the given kernel and adds them to a crease pattern.
+     * @param builder Receives the perpendicular creases
+     * @param stats Receives the perpendicular timing and counters
+     */
+    template <class Kernel>
+    void addPerpendicularCreases(CreasePatternBuilder& builder, PipelineStats& stats) const;
+
+    /**
+     * @brief Classifies the skeleton edges between two faces, each once.
+     * @param visit Called as visit(faceIndex, edgeIndex, start, end, foldType) per skeleton crease
+     */
+    template <class Visitor>
+    void forEachSkeletonCrease(Visitor&& visit) const;
 };
 
 }  // namespace OneCut
\ No newline at end of file
@@ -0,0 +1,66 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "SkeletonBuilder.h"
+
+namespace OneCut {
+
+/**
+ * @struct FoldData
+ * @brief Geometry read from a FOLD file.
+ *
+ * Only the top-level frame is read; file_frames and all other keys are skipped.
+ */
+struct FoldData {
+    std::vector<double> vertexCoordinates;  ///< Interleaved x and y of vertices_coords (z is dropped)
+    std::vector<int> edgeVertices;          ///< Two vertex indices per entry of edges_vertices
+    std::string edgeAssignments;            ///< First letter of every entry of edges_assignment
+    std::vector<std::vector<int>> faces;    ///< faces_vertices
+
+    /**
+     * @brief Gets the number of vertices.
+     * @return Half the length of vertexCoordinates
+     */
+    size_t vertexCount() const { return vertexCoordinates.size() / 2; }
+
+    /**
+     * @brief Recovers the polygons bounded by the boundary edges.
+     * @return One polygon per closed ring of "B" edges, in the order of their smallest vertex index.
+     *         Files without edge assignments fall back to faces_vertices.
+     *
+     * Rings are followed through vertices with exactly two boundary edges; components with
+     * other vertex degrees are not closed rings and are skipped.
+     */
+    std::vector<std::vector<SkeletonConstruction::Point>> boundaryPolygons() const;
+};
+
+/**
+ * @class FoldReader
+ * @brief Reads the geometry of FOLD files without building a JSON document.
+ *
+ * The file is memory-mapped and the wanted arrays are parsed in place with a single forward
+ * scan, so reading runs at about the speed of the disk and needs no memory besides the result.
+ */
+class FoldReader {
+   public:
+    /**
+     * @brief Reads a FOLD file.
+     * @param path The file to read
+     * @return The geometry of the top-level frame
+     * @throws std::runtime_error if the file cannot be read or is not valid JSON
+     */
+    static FoldData read(const std::string& path);
+
+    /**
+     * @brief Parses FOLD JSON text.
+     * @param json The text of a FOLD file
+     * @return The geometry of the top-level frame
+     * @throws std::runtime_error if the text is not valid JSON
+     */
+    static FoldData parse(std::string_view json);
+};
+
+}  // namespace OneCut
@@ -0,0 +1,104 @@
+#pragma once
+
+#include <cstdint>
+#include <ostream>
+#include <span>
+#include <string>
+#include <vector>
+
+#include "Crease.h"
+#include "CreasePattern.h"
+#include "SkeletonBuilder.h"
+
+namespace OneCut {
+
+/**
+ * @struct FoldFileInfo
+ * @brief File metadata written into a FOLD file.
+ */
+struct FoldFileInfo {
+    std::string creator = "Straight-Skeleton Tool";     ///< file_creator
+    std::string author;                                 ///< file_author; omitted if empty
+    std::vector<std::string> classes = {"foldedForm"};  ///< file_classes; omitted if empty
+};
+
+/**
+ * @class FoldWriter
+ * @brief Writes crease patterns as FOLD files (https://github.com/edemaine/fold).
+ *
+ * The output has the layout of the files written by the GUI: the polygon vertices come
+ * first and form faces_vertices[0] and the boundary ("B") edges, followed by the crease
+ * end points and one "M", "V" or "F" edge per crease. Points within the weld tolerance of
+ * each other share a vertex, and creases that collapse to a point are dropped.
+ *
+ * The polygon and the creases are welded into a CreasePattern with a CreasePatternBuilder,
+ * which is then written out.
+ */
+class FoldWriter {
+   public:
+    /// Default distance below which crease end points are welded
+    static constexpr double DEFAULT_WELD_TOLERANCE = 1e-9;
+
+    /**
+     * @brief Constructs a writer.
+     * @param info Metadata written into every file
+     * @param weldTolerance Points within this distance of each other share a vertex; 0 welds only
+     *                      equal coordinates
+     */
+    explicit FoldWriter(const FoldFileInfo& info = FoldFileInfo(), double weldTolerance = DEFAULT_WELD_TOLERANCE);
+
+    /**
+     * @brief Writes a crease pattern to a stream.
+     * @param os Destination of the JSON text
+     * @param polygon The polygon the creases were computed for
+     * @param creases The creases; creases with Origin::POLYGON are skipped, the boundary comes from the polygon
+     */
+    void write(std::ostream& os, const std::vector<SkeletonConstruction::Point>& polygon,
+               const std::vector<Crease>& creases) const;
+
+    /**
+     * @brief Writes a crease pattern given as flat arrays to a stream.
+     * @param os Destination of the JSON text
+     * @param polygon The polygon the creases were computed for
+     * @param segments Four coordinates (x1, y1, x2, y2) per crease
+     * @param foldTypes One FoldType value per crease
+     * @throws std::invalid_argument if the array lengths do not match
+     */
+    void write(std::ostream& os, const std::vector<SkeletonConstruction::Point>& polygon,
+               std::span<const double> segments, std::span<const std::int8_t> foldTypes) const;
+
+    /**
+     * @brief Writes an indexed crease pattern to a stream.
+     * @param os Destination of the JSON text
+     * @param polygon The polygon the creases were computed for
+     * @param pattern The creases, e.g. from FoldManager::getCreasePattern(); Origin::POLYGON creases are skipped
+     */
+    void write(std::ostream& os, const std::vector<SkeletonConstruction::Point>& polygon,
+               const CreasePattern& pattern) const;
+
+    /**
+     * @brief Writes a crease pattern to a file.
+     * @param path The file to create or overwrite
+     * @param polygon The polygon the creases were computed for
+     * @param creases The creases
+     * @throws std::runtime_error if the file cannot be written
+     */
+    void writeFile(const std::string& path, const std::vector<SkeletonConstruction::Point>& polygon,
+                   const std::vector<Crease>& creases) const;
+
+   private:
+    FoldFileInfo info;     ///< Metadata written into every file
+    double weldTolerance;  ///< Largest distance of welded points, 0 for exact matches
+
+    /**
+     * @brief Writes the file: metadata, vertices, welded creases and edges.
+     * @param creaseCount Number of creases
+     * @param crease Called as crease(i, coordinates) and returns the std::optional<FoldType> of crease i,
+     *               or std::nullopt to skip it; fills coordinates with x1, y1, x2, y2
+     */
+    template <class CreaseSource>
+    void writeJson(std::ostream& os, const std::vector<SkeletonConstruction::Point>& polygon, size_t creaseCount,
+                   CreaseSource&& crease) const;
+};
+
+}  // namespace OneCut
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "StraightSkeletonTypes.h"
+#include <span>
 #include <vector>
 #include <iostream>
 
@@ -37,6 +38,8 @@ public:
     /**
      * @brief Gets all vertices of the face in order.
      * @return Vector containing all vertices in clockwise or counter-clockwise order.
+     * @note Copies every vertex; kept for compatibility. Read-only callers should use
+     *       vertex() or the span accessors of the concrete face types.
      */
     virtual std::vector<Point> getVertices() const = 0;
 
@@ -45,9 +48,26 @@ public:
      * @return Vector containing indices of neighboring faces.
      * 
      * The adjacency order corresponds to the edge order of this face.
+     * @note Copies the adjacency; kept for compatibility. Prefer adjacentFaceSpan().
      */
     virtual std::vector<int> getAdjacentFaces() const = 0;
 
+    /**
+     * @brief Gets indices of all adjacent faces without copying them.
+     * @return View of the adjacency in edge order, valid as long as the face exists.
+     */
+    virtual std::span<const int> adjacentFaceSpan() const = 0;
+
+    /**
+     * @brief Gets, for every edge, its index in the adjacent face (the twin edge).
+     * @return View with one entry per edge (-1 where there is no adjacent face), or an
+     *         empty span if the face carries no twin table.
+     *
+     * Edge i of this face and edge twinEdgeSpan()[i] of face adjacentFaceIndex(i) are the
+     * same segment, traversed in opposite directions.
+     */
+    virtual std::span<const int> twinEdgeSpan() const { return {}; }
+
     /**
      * @brief Gets the adjacent face index for a specific edge.
      * @param i Edge index (0 <= i < vertexCount())
@@ -0,0 +1,44 @@
+#pragma once
+
+#include <limits>
+
+namespace OneCut {
+
+/**
+ * @struct Paper
+ * @brief Axis-aligned rectangle of the sheet that is folded and cut.
+ *
+ * Creases are only needed on the sheet: the SkeletonBuilder clips the outer skeleton faces
+ * to it and the PerpendicularFinder starts no chain outside it and stops chains at its
+ * border. The polygon itself has to lie on the paper; the SkeletonBuilder rejects vertices
+ * off it.
+ */
+struct Paper {
+    /// Side length of the default sheet, which matches the canvas of the GUI
+    static constexpr double DEFAULT_SIZE = 600;
+
+    double xMin = 0;             ///< Left border
+    double yMin = 0;             ///< Bottom border
+    double xMax = DEFAULT_SIZE;  ///< Right border
+    double yMax = DEFAULT_SIZE;  ///< Top border
+
+    /**
+     * @brief Gets a paper without borders, which disables all clipping.
+     */
+    static Paper unbounded() {
+        double infinity = std::numeric_limits<double>::infinity();
+        return {-infinity, -infinity, infinity, infinity};
+    }
+
+    /**
+     * @brief Checks whether a point lies on the paper; points on the border do.
+     */
+    template <class Number>
+    bool contains(const Number& x, const Number& y) const {
+        return !(x < xMin || y < yMin || x > xMax || y > yMax);
+    }
+
+    bool operator==(const Paper& other) const = default;
+};
+
+}  // namespace OneCut
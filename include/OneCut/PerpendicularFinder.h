@@ -1,6 +1,14 @@
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
 #include "IStraightSkeleton.h"
+#include "Paper.h"
+#include "PipelineStats.h"
+#include "SkeletonFace.h"
 #include "StraightSkeletonTypes.h"
 #include "utils/GeometryUtil.h"
 #include "utils/IntersectionUtil.h"
@@ -8,52 +16,120 @@
 namespace OneCut {
 
 /**
- * @struct PerpSegment
+ * @struct BasicPerpSegment
  * @brief Represents a segment of a perpendicular fold with its associated face.
+ * @tparam Kernel CGAL kernel of the segment end points
  */
-struct PerpSegment {
-    Point start;        ///< Starting point of the perpendicular segment
-    Point end;          ///< Ending point of the perpendicular segment
-    int faceIndex;      ///< Index of the face this segment belongs to
+template <class Kernel>
+struct BasicPerpSegment {
+    typename Kernel::Point_2 start;  ///< Starting point of the perpendicular segment
+    typename Kernel::Point_2 end;    ///< Ending point of the perpendicular segment
+    int faceIndex;                   ///< Index of the face this segment belongs to
 };
 
 /**
- * @struct PerpendicularHit
+ * @struct BasicPerpendicularHit
  * @brief Represents the result of a perpendicular intersection calculation.
+ * @tparam Kernel CGAL kernel of the intersection point
  */
-struct PerpendicularHit {
-    bool isValid;       ///< True if a valid intersection was found
-    Point intersection; ///< Point of intersection (if valid)
-    int edgeIndex;      ///< Index of the intersected edge
+template <class Kernel>
+struct BasicPerpendicularHit {
+    bool isValid;                           ///< True if a valid intersection was found
+    typename Kernel::Point_2 intersection;  ///< Point of intersection (if valid)
+    int edgeIndex;                          ///< Index of the intersected edge
 };
 
 /**
- * @typedef PerpChain
+ * @enum ChainTermination
+ * @brief Reason a perpendicular chain stopped.
+ */
+enum class ChainTermination {
+    BOUNDARY,            ///< Left the paper, or crossed an edge without an adjacent face
+    INVALID_HIT,         ///< Found no intersection in the current face
+    EDGE_LOOKUP_FAILED,  ///< The crossed edge was not found in the adjacent face
+    CYCLE,               ///< Re-entered a face through an edge point it had already crossed
+    CHAIN_BUDGET,        ///< Used up the iterations allowed per chain
+    JOB_BUDGET,          ///< The iterations allowed for the whole call were used up
+    MERGED               ///< Joined a path an earlier chain of the graph had already traced
+};
+
+/**
+ * @typedef BasicPerpChain
  * @brief A sequence of connected perpendicular segments forming a complete fold line.
  */
-typedef std::vector<PerpSegment> PerpChain;
+template <class Kernel>
+using BasicPerpChain = std::vector<BasicPerpSegment<Kernel>>;
 
 /**
- * @class PerpendicularFinder
+ * @struct PerpGraphSegment
+ * @brief Segment of a perpendicular graph, referencing its end points by index.
+ */
+struct PerpGraphSegment {
+    int start;      ///< Index of the start point in BasicPerpGraph::vertices
+    int end;        ///< Index of the end point in BasicPerpGraph::vertices
+    int faceIndex;  ///< Index of the face this segment belongs to
+};
+
+/**
+ * @struct BasicPerpGraph
+ * @brief All perpendicular folds as a graph, with every point and every segment stored once.
+ * @tparam Kernel CGAL kernel of the points
+ */
+template <class Kernel>
+struct BasicPerpGraph {
+    std::vector<typename Kernel::Point_2> vertices;  ///< Distinct end points of the segments
+    std::vector<PerpGraphSegment> segments;          ///< Distinct segments, in tracing order
+};
+
+/// @name Exact Kernel Types
+/// @{
+using PerpSegment = BasicPerpSegment<ExactKernel>;            ///< Segment with exact end points
+using PerpendicularHit = BasicPerpendicularHit<ExactKernel>;  ///< Hit with an exact intersection point
+typedef std::vector<PerpSegment> PerpChain;                   ///< Chain of exact segments
+using PerpGraph = BasicPerpGraph<ExactKernel>;                ///< Graph with exact points
+/// @}
+
+/**
+ * @class BasicPerpendicularFinder
  * @brief Computes perpendicular folds for one-cut origami based on a straight skeleton.
  *
  * This class calculates the perpendicular fold lines that connect from polygon vertices
  * to the skeleton edges, used in the one-cut origami algorithm.
+ *
+ * Faces that already store points of the kernel are read in place through spans; all
+ * other faces are converted into the kernel once, on construction. The skeleton must
+ * therefore outlive the finder. The per-face ray-casting data (see PreparedFace) is
+ * also computed on construction, so tracing does no square roots.
+ *
+ * PerpendicularFinder traces with exact constructions; FastPerpendicularFinder uses
+ * doubles, which is considerably faster and is what FoldManager uses unless
+ * FoldOptions::exactKernel is set.
+ *
+ * @tparam Kernel CGAL kernel used for tracing
  */
-class PerpendicularFinder {
+template <class Kernel>
+class BasicPerpendicularFinder {
    public:
-    /// Maximum iterations allowed for finding perpendiculars
+    using KernelPoint = typename Kernel::Point_2;    ///< Point type of the kernel
+    using KernelVector = typename Kernel::Vector_2;  ///< Vector type of the kernel
+    using Chain = BasicPerpChain<Kernel>;            ///< Chain in the kernel
+    using Graph = BasicPerpGraph<Kernel>;            ///< Graph in the kernel
+
+    /// Default number of iterations a single chain may take
     static const int MAX_ITERATIONS = 30;
-    /// X-dimension boundary of the paper (for validation)
-    static const int PAPER_BORDER_X = 600;
-    /// Y-dimension boundary of the paper (for validation)
-    static const int PAPER_BORDER_Y = 600;
+    /// Distance within which points of the perpendicular graph are merged
+    static constexpr double VERTEX_SNAP = 1e-7;
 
     /**
      * @brief Constructs a PerpendicularFinder for the given skeleton.
      * @param skeleton The straight skeleton to compute perpendiculars for.
      */
-    PerpendicularFinder(const IStraightSkeleton& skeleton);
+    BasicPerpendicularFinder(const IStraightSkeleton& skeleton);
+
+    BasicPerpendicularFinder(const BasicPerpendicularFinder&) = delete;
+    BasicPerpendicularFinder& operator=(const BasicPerpendicularFinder&) = delete;
+    BasicPerpendicularFinder(BasicPerpendicularFinder&&) = default;
+    BasicPerpendicularFinder& operator=(BasicPerpendicularFinder&&) = default;
 
     /**
      * @brief Finds all perpendicular fold chains in the skeleton.
@@ -63,24 +139,240 @@ class PerpendicularFinder {
      * @note The algorithm traces perpendiculars until they either:
      *       - Reach the paper boundary
      *       - Fail to find a valid intersection
-     *       - Exceed MAX_ITERATIONS
+     *       - Run into a cycle
+     *       - Use up the chain or job budget
+     *       The reason of every returned chain is available from getTerminations().
      */
-    std::vector<PerpChain> findPerpendiculars();
+    std::vector<Chain> findPerpendiculars();
+
+    /**
+     * @brief Finds all perpendicular fold chains and records instrumentation.
+     * @param stats Receives the tracing duration and the chain, iteration and termination
+     *              counters; other fields are left untouched
+     * @return Vector of perpendicular chains, identical to findPerpendiculars()
+     */
+    std::vector<Chain> findPerpendiculars(PipelineStats& stats);
+
+    /**
+     * @brief Finds all perpendicular folds as a graph without duplicate points or segments.
+     * @return The graph; its segments are the union of the segments of findPerpendiculars()
+     *
+     * Chains meeting at a skeleton vertex or crossing the same edge at the same point share
+     * the rest of their path. Points within VERTEX_SNAP of a graph vertex are merged into it,
+     * and a chain stops as soon as it enters a face through an edge point from which an earlier
+     * chain traced at least as many iterations as this chain has left, or to its natural end.
+     * Shared suffixes are thus traced once, and a suffix an earlier chain had to cut short by
+     * its budget is continued. Segments traced in opposite directions are emitted once.
+     * @note Early stopping needs the chains in order, so it only saves work when tracing
+     *       serially; with more threads the chains are traced in full and merged in order,
+     *       which gives the same graph.
+     */
+    Graph findPerpendicularGraph();
+
+    /**
+     * @brief Finds the perpendicular graph and records instrumentation.
+     * @param stats Receives the tracing duration and the chain, iteration and termination
+     *              counters; other fields are left untouched
+     * @return The same graph as findPerpendicularGraph()
+     */
+    Graph findPerpendicularGraph(PipelineStats& stats);
+
+    /**
+     * @brief Sets the number of threads tracing chains.
+     * @param threadCount 1 traces serially (default), 0 uses all hardware threads
+     *
+     * Every seed vertex is traced independently; idle threads take the next chunk of
+     * seeds. The chains are returned in the same order as with a single thread.
+     * @note With ExactKernel, threads share lazy-exact numbers, which requires CGAL to
+     *       be built with thread support (CGAL_HAS_THREADS, the default).
+     */
+    void setThreadCount(int threadCount);
+
+    /**
+     * @brief Gets the configured number of threads.
+     * @return The value passed to setThreadCount(), 1 by default
+     */
+    int getThreadCount() const;
+
+    /**
+     * @brief Sets the number of iterations a single chain may take.
+     * @param chainBudget Maximum iterations per chain, MAX_ITERATIONS by default; 0 for no limit
+     *
+     * Chains caught in a loop are stopped by cycle detection regardless of the budget, so a
+     * larger budget only lets long legitimate chains run to the end.
+     */
+    void setChainBudget(int chainBudget);
+
+    /**
+     * @brief Gets the per-chain iteration budget.
+     * @return The value passed to setChainBudget()
+     */
+    int getChainBudget() const;
+
+    /**
+     * @brief Sets the number of iterations one findPerpendiculars() or findPerpendicularGraph() call may take.
+     * @param jobBudget Maximum iterations summed over all chains of a call, 0 for no limit (default)
+     *
+     * Once it is used up, every chain still being traced stops with ChainTermination::JOB_BUDGET,
+     * which bounds the tracing time of pathological skeletons.
+     * @note The budget is charged in seed order, so with a budget the chains are traced on a
+     *       single thread regardless of setThreadCount(). Which chains are cut short, and thus
+     *       the result, does not depend on the thread count.
+     */
+    void setJobBudget(size_t jobBudget);
+
+    /**
+     * @brief Gets the per-call iteration budget.
+     * @return The value passed to setJobBudget()
+     */
+    size_t getJobBudget() const;
+
+    /**
+     * @brief Sets the sheet the chains are traced on.
+     * @param paper The paper, Paper() (600 x 600 from the origin) by default
+     *
+     * Only skeleton vertices on the paper start chains, and a chain leaving the paper is
+     * cut at its border and stops there with ChainTermination::BOUNDARY.
+     */
+    void setPaper(const Paper& paper);
+
+    /**
+     * @brief Gets the sheet the chains are traced on.
+     * @return The value passed to setPaper()
+     */
+    const Paper& getPaper() const;
+
+    /**
+     * @brief Gets why the chains of the last findPerpendiculars() call stopped.
+     * @return One reason per returned chain, in the same order
+     */
+    const std::vector<ChainTermination>& getTerminations() const;
 
    private:
-    const IStraightSkeleton& skeleton; ///< Reference to the straight skeleton
+    /**
+     * @struct PreparedFace
+     * @brief Ray-casting tables of one face, built once on construction.
+     *
+     * Everything computePerpendicularIntersection() needs that only depends on the face:
+     * the unit perpendicular of the cut edge, and per edge its origin, direction vector
+     * and the side the perpendicular has to point to.
+     */
+    struct PreparedFace {
+        std::span<const KernelPoint> vertices;            ///< Edge origins, in the kernel
+        std::span<const int> adjacentFaces;               ///< Adjacent face per edge, viewed in the skeleton
+        std::span<const int> twinEdges;                   ///< Edge index in the adjacent face; empty if unknown
+        std::span<const KernelVector> edgeVectors;        ///< vertices[i + 1] - vertices[i]
+        std::span<const std::uint8_t> perpendicularSide;  ///< Index into perpendiculars for rays from edge i
+        KernelVector perpendiculars[2];                   ///< Unit perpendicular of the cut edge and its negation
+
+        size_t vertexCount() const { return vertices.size(); }
+    };
+
+    /**
+     * @struct Seed
+     * @brief Polygon vertex a perpendicular chain starts from.
+     */
+    struct Seed {
+        int faceIndex;    ///< Face whose skeleton vertex starts the chain
+        int vertexIndex;  ///< Index of that vertex in the face
+    };
+
+    /**
+     * @struct JobBudget
+     * @brief Iterations left to one findPerpendiculars() or findPerpendicularGraph() call, shared by all threads.
+     */
+    struct JobBudget;
+
+    std::vector<KernelPoint> ownedVertices;          ///< Converted vertices of faces stored in another kernel
+    std::vector<KernelVector> edgeVectors;           ///< Edge vectors of all faces
+    std::vector<std::uint8_t> perpendicularSides;    ///< Perpendicular side of all edges
+    std::vector<PreparedFace> faces;                 ///< One prepared face per skeleton face
+    int threadCount = 1;                             ///< Threads used by findPerpendiculars(), 0 for all
+    int chainBudget = MAX_ITERATIONS;                ///< Iterations per chain, 0 for no limit
+    size_t jobBudget = 0;                            ///< Iterations per call, 0 for no limit
+    Paper paper;                                     ///< Sheet chains start on and stop at
+    std::vector<ChainTermination> terminations;      ///< Reasons of the chains of the last findPerpendiculars()
+
+    /**
+     * @brief Fills the edge vectors, perpendicular sides and perpendiculars of all faces.
+     * @pre The vertex and adjacency spans of all faces are set
+     */
+    void prepareFaces();
+
+    /**
+     * @brief Collects the start vertices of all chains in the serial tracing order.
+     * @return Seeds with adjacent faces on both sides and on the paper
+     */
+    std::vector<Seed> collectSeeds() const;
+
+    /**
+     * @brief Traces the perpendicular chain starting at one seed.
+     * @param seed The start vertex
+     * @param budget The iterations left to the call
+     * @param stats Receives the iteration and termination counters
+     * @param termination Receives the reason the chain stopped
+     * @return The chain; empty if the first intersection is invalid
+     */
+    Chain traceChain(const Seed& seed, JobBudget& budget, PipelineStats& stats, ChainTermination& termination) const;
+
+    /**
+     * @brief Calls trace(seedIndex, stats) for every seed, on getThreadCount() threads.
+     * @param seedCount Number of seeds
+     * @param stats Receives the iteration and termination counters of all threads
+     * @param trace Must only write state owned by its seed; exceptions are rethrown after all threads joined
+     */
+    template <class Trace>
+    void forEachSeed(size_t seedCount, PipelineStats& stats, Trace&& trace) const;
+
+    /**
+     * @brief Traces one chain and hands every segment to a visitor.
+     * @param seed The start vertex
+     * @param budget The iterations left to the call; every iteration takes one
+     * @param stats Receives the iteration and termination counters
+     * @param visit Called as visit(segment, nextFaceIndex, nextEdgeIndex) for every segment;
+     *              the next indices are -1 if the chain ends there. Returning false stops the chain.
+     * @return Why the chain stopped
+     *
+     * Records a "chain" span with the seed, the iteration count and the termination if a Tracer
+     * is installed.
+     */
+    template <class SegmentVisitor>
+    ChainTermination traceSegments(const Seed& seed, JobBudget& budget, PipelineStats& stats,
+                                   SegmentVisitor&& visit) const;
+
+    /**
+     * @brief Does the work of traceSegments(), which adds the tracing span around it.
+     *
+     * Cycles are detected with Brent's algorithm on the (face, entry edge, entry point) of every
+     * step, with points compared on the VERTEX_SNAP grid. A chain running in a loop is stopped
+     * within two rounds of it, without storing the path.
+     */
+    template <class SegmentVisitor>
+    ChainTermination walkSegments(const Seed& seed, JobBudget& budget, PipelineStats& stats,
+                                  SegmentVisitor&& visit) const;
 
     /**
      * @brief Computes the intersection of a perpendicular from a vertex to a face edge.
      * @param vertex The starting vertex of the perpendicular.
-     * @param face The face to compute intersection with.
+     * @param face The prepared face to compute intersection with.
      * @param edgeIndex Index of the edge to check against.
      * @return PerpendicularHit structure containing intersection results.
      */
-    PerpendicularHit computePerpendicularIntersection(
-        const Point& vertex, 
-        const ISkeletonFace& face, 
-        int edgeIndex);
+    BasicPerpendicularHit<Kernel> computePerpendicularIntersection(
+        const KernelPoint& vertex, 
+        const PreparedFace& face, 
+        int edgeIndex) const;
+
+    /**
+     * @brief Finds the edge of the adjacent face a chain continues on after crossing an edge.
+     * @param face The face the chain leaves.
+     * @param edgeIndex The edge it leaves through.
+     * @return Index of the same edge in the adjacent face, or -1.
+     *
+     * Uses the twin table of the skeleton if it has one (O(1), independent of rounding),
+     * otherwise searches the adjacent face for the end point of the edge.
+     */
+    int crossEdge(const PreparedFace& face, int edgeIndex) const;
 
     /**
      * @brief Finds the index of the edge in a face closest to a starting point.
@@ -88,7 +380,13 @@ class PerpendicularFinder {
      * @param startPoint The reference point for finding the nearest edge.
      * @return Index of the most relevant edge for perpendicular calculation.
      */
-    int findEdgeIndex(const ISkeletonFace& face, const Point& startPoint) const;
+    int findEdgeIndex(const PreparedFace& face, const KernelPoint& startPoint) const;
 };
 
-}  // namespace OneCut
\ No newline at end of file
+extern template class BasicPerpendicularFinder<ExactKernel>;
+extern template class BasicPerpendicularFinder<FastKernel>;
+
+using PerpendicularFinder = BasicPerpendicularFinder<ExactKernel>;     ///< Finder with exact constructions
+using FastPerpendicularFinder = BasicPerpendicularFinder<FastKernel>;  ///< Finder with double constructions
+
+}  // namespace OneCut
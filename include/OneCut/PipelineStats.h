@@ -0,0 +1,78 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+
+namespace OneCut {
+
+/**
+ * @struct PipelineStats
+ * @brief Instrumentation of one crease computation.
+ *
+ * Filled by the SkeletonBuilder (skeleton stages), the PerpendicularFinder (chain tracing)
+ * and the FoldManager (crease assembly). Durations are wall-clock times in milliseconds;
+ * a stage that did not run reports 0.
+ */
+struct PipelineStats {
+    /// @name Stage Durations (ms)
+    /// @{
+    double interiorSkeletonMs = 0.0; ///< CGAL interior straight skeleton construction
+    double exteriorSkeletonMs = 0.0; ///< CGAL exterior straight skeleton construction
+    double innerFacesMs = 0.0;       ///< Conversion of the inner skeleton into faces
+    double outerFacesMs = 0.0;       ///< Conversion of the outer skeleton into faces
+    double perpendicularsMs = 0.0;   ///< Tracing of the perpendicular chains
+    double creaseAssemblyMs = 0.0;   ///< Assembly of the skeleton and perpendicular creases
+    double totalMs = 0.0;            ///< Sum of all stages above
+    /// @}
+
+    /// @name Skeleton Counters
+    /// @{
+    size_t polygonVertexCount = 0;  ///< Vertices of the input polygon
+    size_t innerFaceCount = 0;      ///< Faces of the inner skeleton
+    size_t outerFaceCount = 0;      ///< Faces of the outer skeleton
+    size_t faceVertexCount = 0;     ///< Vertices summed over all faces
+    size_t edgeMapMisses = 0;       ///< Outer border edges without a matching polygon edge
+    size_t clippedOuterFaces = 0;   ///< Outer faces reaching past the paper, cut at its border or dropped
+    size_t arenaBytes = 0;          ///< Memory of the CGAL skeletons, taken from the builder's arena
+    /// @}
+
+    /// @name Perpendicular Counters
+    /// With serial tracing every chain is counted in exactly one of invalidHits, edgeLookupFailures,
+    /// revisitedEdgePoints and the *Stops counters, according to why it ended.
+    /// @{
+    size_t chainCount = 0;          ///< Non-empty perpendicular chains
+    size_t chainIterations = 0;     ///< Tracing steps summed over all chains
+    size_t invalidHits = 0;         ///< Steps that found no intersection in the current face
+    size_t edgeLookupFailures = 0;  ///< Steps whose crossed edge was not found in the adjacent face
+    size_t revisitedEdgePoints = 0; ///< Graph chains stopped at an edge point an earlier chain entered
+    size_t duplicateSegments = 0;   ///< Graph segments dropped because they were already emitted
+    size_t boundaryStops = 0;       ///< Chains that crossed an edge without an adjacent face
+    size_t cycleStops = 0;          ///< Chains stopped because they ran in a loop
+    size_t chainBudgetStops = 0;    ///< Chains cut off by the per-chain iteration budget
+    size_t jobBudgetStops = 0;      ///< Chains cut off because the per-call iteration budget was used up
+    /// @}
+
+    size_t creaseCount = 0;         ///< Creases returned by the FoldManager
+};
+
+/**
+ * @class StageTimer
+ * @brief Measures the wall-clock time since its construction.
+ */
+class StageTimer {
+   public:
+    StageTimer() : start(std::chrono::steady_clock::now()) {}
+
+    /**
+     * @brief Gets the elapsed time.
+     * @return Milliseconds since construction
+     */
+    double elapsedMs() const {
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    }
+
+   private:
+    std::chrono::steady_clock::time_point start; ///< Time of construction
+};
+
+}  // namespace OneCut
@@ -3,19 +3,28 @@
 #include <algorithm>
 #include <cmath>
 #include <iostream>
-#include <map>
+#include <memory>
+#include <optional>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
 // CGAL headers for kernel and surface mesh
 #include <CGAL/Exact_predicates_exact_constructions_kernel.h>
 #include <CGAL/Polygon_2.h>
-#include <CGAL/Straight_skeleton_2/IO/print.h>
+#include <CGAL/Polygon_with_holes_2.h>
+#include <CGAL/Straight_skeleton_2.h>
+#include <CGAL/Straight_skeleton_items_2.h>
 #include <CGAL/Surface_mesh.h>
 #include <CGAL/create_straight_skeleton_2.h>
 #include <CGAL/draw_straight_skeleton_2.h>
 
+#include "Arena.h"
+#include "CompactSkeleton.h"
 #include "Crease.h"
+#include "Diagnostics.h"
+#include "Paper.h"
+#include "PipelineStats.h"
 #include "SkeletonFace.h"
 #include "StraightSkeleton.h"
 
@@ -26,7 +35,9 @@ namespace SkeletonConstruction {
 typedef CGAL::Exact_predicates_inexact_constructions_kernel K; ///< CGAL kernel with exact predicates
 typedef K::Point_2 Point;                                      ///< 2D point type for geometric calculations
 typedef CGAL::Polygon_2<K> Polygon_2;                          ///< Polygon container type
-typedef CGAL::Straight_skeleton_2<K> Ss;                       ///< Straight skeleton data structure
+typedef CGAL::Polygon_with_holes_2<K> Polygon_with_holes_2;    ///< Polygon with holes container type
+/// Straight skeleton data structure; its halfedge data structure is allocated from the builder's arena
+typedef CGAL::Straight_skeleton_2<K, CGAL::Straight_skeleton_items_2, OneCut::ArenaAllocator<int>> Ss;
 /// @}
 
 /// @name Smart Pointers and Surface Mesh
@@ -35,69 +46,165 @@ typedef std::shared_ptr<Ss> SsPtr;                ///< Shared pointer to straigh
 typedef CGAL::Surface_mesh<Point> SurfaceMesh;    ///< Surface mesh representation
 /// @}
 
+/**
+ * @enum ExteriorMode
+ * @brief Specifies when the SkeletonBuilder computes the exterior skeleton
+ */
+enum class ExteriorMode {
+    EAGER, ///< The constructor computes the exterior skeleton and the outer faces
+    LAZY   ///< The exterior skeleton is computed on the first call to buildSkeleton()
+};
+
 /**
  * @class SkeletonBuilder
  * @brief Builds a StraightSkeleton object using CGAL's straight skeleton algorithms
  * 
  * Constructs both inner and outer straight skeletons from input polygons and converts them
  * into a unified data structure with proper face adjacencies for perpendicular fold computation.
+ *
+ * The input is either one simple polygon or a drawing of several disjoint shapes, each with
+ * any number of holes; a shape may also lie inside the hole of another one. The interior
+ * skeleton is built per shape. The exterior skeleton covers everything outside the shapes:
+ * one skeleton between a common frame and all top-level shapes, plus one per hole, bounded
+ * by the hole and the shapes inside it. All skeletons are converted into one face set, so
+ * the perpendiculars of the whole drawing are traced in a single pass.
+ *
+ * The exterior skeleton reaches far beyond the shapes. Given a paper, the outer faces are
+ * clipped to it: edges on the paper border have no adjacent face, and faces whose cut edge
+ * lies off the paper, like those of the frame, are left empty so face indices stay stable.
+ *
+ * The vertices, halfedges and faces of the CGAL skeletons are allocated from an Arena owned
+ * by the builder and freed together when it is destroyed. A builder can be moved but not copied.
  */
 class SkeletonBuilder {
    public:
     /**
      * @brief Construct a new Skeleton Builder from polygon vertices
      * @param polygon_points Input polygon vertices in counter-clockwise order
+     * @param exteriorMode Whether the exterior skeleton is computed right away or on first use
+     * @param paper Sheet the outer faces are clipped to; std::nullopt keeps them whole
+     * @throws std::invalid_argument If a polygon vertex lies off the paper
      * @note The polygon must be simple (non-intersecting) and non-degenerate
      */
-    explicit SkeletonBuilder(const std::vector<Point>& polygon_points);
+    explicit SkeletonBuilder(const std::vector<Point>& polygon_points,
+                             ExteriorMode exteriorMode = ExteriorMode::EAGER,
+                             std::optional<OneCut::Paper> paper = std::nullopt);
+
+    /**
+     * @brief Construct a new Skeleton Builder from a drawing of several shapes
+     * @param shapes Disjoint shapes with holes; the orientation of the rings does not matter
+     * @param exteriorMode Whether the exterior skeleton is computed right away or on first use
+     * @param paper Sheet the outer faces are clipped to; std::nullopt keeps them whole
+     * @throws std::invalid_argument If a ring vertex lies off the paper
+     * @note Rings must be simple, must not touch each other and must not share vertices.
+     *       Inner faces are numbered shape by shape, in input order.
+     */
+    explicit SkeletonBuilder(const std::vector<Polygon_with_holes_2>& shapes,
+                             ExteriorMode exteriorMode = ExteriorMode::EAGER,
+                             std::optional<OneCut::Paper> paper = std::nullopt);
 
     /**
      * @brief Build the complete straight skeleton structure
      * @return OneCut::StraightSkeleton Combined skeleton containing both inner and outer faces
-     * @details Merges inner and outer skeletons while maintaining proper face adjacencies
+     * @details Merges inner and outer skeletons while maintaining proper face adjacencies.
+     *          In ExteriorMode::LAZY the first call computes the exterior skeleton.
      */
     OneCut::StraightSkeleton buildSkeleton();
 
+    /**
+     * @brief Build the complete straight skeleton in flat-array form
+     * @return OneCut::CompactSkeleton with the same faces, in the same order, as buildSkeleton()
+     * @details Avoids the per-face allocations and exact point conversions of buildSkeleton().
+     *          In ExteriorMode::LAZY the first call computes the exterior skeleton.
+     */
+    OneCut::CompactSkeleton buildCompactSkeleton();
+
+    /**
+     * @brief Build a straight skeleton containing only the inner faces
+     * @return OneCut::StraightSkeleton with the inner faces; polygon edges have no adjacent face (-1)
+     * @details Never computes the exterior skeleton
+     */
+    OneCut::StraightSkeleton buildInteriorSkeleton() const;
+
+    /**
+     * @brief Build the inner faces in flat-array form
+     * @return OneCut::CompactSkeleton with the faces of buildInteriorSkeleton()
+     * @details Never computes the exterior skeleton
+     */
+    OneCut::CompactSkeleton buildCompactInteriorSkeleton() const;
+
+    /**
+     * @brief Check whether the exterior skeleton has been computed
+     * @return True once the outer faces are available
+     */
+    bool hasExterior() const;
+
+    /**
+     * @brief Get the instrumentation of the construction
+     * @return Stage durations and skeleton counters measured so far (the exterior stages
+     *         stay 0 until the exterior skeleton is built); the perpendicular and crease
+     *         fields are left at 0
+     */
+    const OneCut::PipelineStats& getStats() const;
+
    private:
+    /// Memory of the CGAL skeletons, released in one go with the builder; declared first so it outlives them
+    std::unique_ptr<OneCut::Arena> arena;
+
     /// @name CGAL Skeleton Structures
     /// @{
-    SsPtr iss_; ///< Inner straight skeleton (contour offsetting)
-    SsPtr oss_; ///< Outer straight skeleton (polygon boundary)
+    std::vector<SsPtr> iss_; ///< Inner straight skeletons, one per shape; empty if one failed
+    std::vector<SsPtr> oss_; ///< Outer straight skeletons (frame region, then one per hole); empty if one failed
     /// @}
 
     /// @name Face Tracking Structures
     /// @{
-    std::map<std::pair<Point, Point>, int> polyEdgeToFaceIndexMap; ///< Maps polygon edges to face indices
-    std::vector<OneCut::SkeletonFace> faces;       ///< All generated faces
-    std::vector<OneCut::SkeletonFace> facesOuter;  ///< Faces from outer skeleton
-    std::vector<OneCut::SkeletonFace> facesInner;  ///< Faces from inner skeleton
-    std::vector<Point> originalPolygonPoints;      ///< Original input vertices
+    std::vector<int> polygonEdgeInnerFace;         ///< Inner face lying on contour edge (i, contourNext[i])
+    std::vector<int> polygonEdgeInnerSlot;         ///< Position of contour edge i in that face's adjacency
+    OneCut::CompactSkeleton facesOuter;            ///< Faces from outer skeletons
+    OneCut::CompactSkeleton facesInner;            ///< Faces from inner skeletons
+    std::vector<Polygon_with_holes_2> shapes;      ///< Input shapes; outer boundaries CCW, holes CW
+    std::vector<Point> contourPoints;              ///< Vertices of all rings, ring after ring
+    std::vector<int> contourNext;                  ///< Index of the next vertex on the same ring
+    bool exteriorBuilt = false;                    ///< Set once the exterior skeleton was computed
+    std::optional<OneCut::Paper> paper;            ///< Sheet the outer faces are clipped to, if any
+    OneCut::PipelineStats stats;                   ///< Stage durations and counters of the construction
     /// @}
 
+    /**
+     * @brief Compute the exterior skeleton and the outer faces, unless done already
+     */
+    void buildExterior();
+
+    /**
+     * @brief Clip the outer faces to the paper and update the adjacency of all faces
+     */
+    void clipOuterFaces(const OneCut::Paper& paper);
+
+    /**
+     * @brief Append a ring to contourPoints and contourNext
+     */
+    void addContour(const Polygon_2& ring);
+
     /// @name Skeleton Conversion Utilities
     /// @{
     /**
      * @brief Convert inner skeleton to face structures
      * @param skeleton CGAL straight skeleton pointer
      * @param offset Index offset for face numbering
-     * @return Vector of generated SkeletonFace objects
+     * @param polygonIndexById Contour vertex index of every CGAL vertex id, -1 for other vertices
+     * @return Compact skeleton with the generated faces
      */
-    std::vector<OneCut::SkeletonFace> innerSkeletonToFaces(SsPtr skeleton, int offset);
+    OneCut::CompactSkeleton innerSkeletonToFaces(SsPtr skeleton, int offset, const std::vector<int>& polygonIndexById);
 
     /**
      * @brief Convert outer skeleton to face structures
      * @param skeleton CGAL straight skeleton pointer
      * @param offset Index offset for face numbering
-     * @return Vector of generated SkeletonFace objects
-     */
-    std::vector<OneCut::SkeletonFace> outerSkeletonToFaces(SsPtr skeleton, int offset);
-
-    /**
-     * @brief Convert CGAL point to application-specific point type
-     * @param point Input CGAL point
-     * @return Converted OneCut::Point
+     * @param polygonIndexById Contour vertex index of every CGAL vertex id, -1 for other vertices
+     * @return Compact skeleton with the generated faces
      */
-    OneCut::Point convertPoint(const Point& point) const;
+    OneCut::CompactSkeleton outerSkeletonToFaces(SsPtr skeleton, int offset, const std::vector<int>& polygonIndexById);
     /// @}
 };
 
@@ -7,14 +7,21 @@
 namespace OneCut {
 
 /**
- * @class SkeletonFace
+ * @class BasicSkeletonFace
  * @brief Concrete implementation of ISkeletonFace representing a face in a straight skeleton.
  *
  * This class stores the geometric and topological information of a single face
  * in the straight skeleton structure, including its vertices and adjacent faces.
+ * SkeletonFace stores exact points; FastSkeletonFace stores double points and converts
+ * them when accessed through the ISkeletonFace interface.
+ *
+ * @tparam Kernel CGAL kernel of the stored vertices
  */
-class SkeletonFace : public ISkeletonFace {
+template <class Kernel>
+class BasicSkeletonFace : public ISkeletonFace {
 public:
+    using KernelPoint = typename Kernel::Point_2;  ///< Point type of the stored vertices
+
     /**
      * @brief Constructs a SkeletonFace with given vertices and adjacency information.
      * @param vertices The ordered vertices of the face (clockwise or counter-clockwise)
@@ -22,7 +29,7 @@ public:
      * @pre vertices.size() == adjacentFaces.size()
      * @pre vertices.size() >= 3 (must form a valid polygon)
      */
-    SkeletonFace(const std::vector<Point>& vertices, const std::vector<int>& adjacentFaces);
+    BasicSkeletonFace(const std::vector<KernelPoint>& vertices, const std::vector<int>& adjacentFaces);
 
     /// @name ISkeletonFace Interface Implementation
     /// @{
@@ -30,16 +37,35 @@ public:
     Point vertex(size_t i) const override;
     std::vector<Point> getVertices() const override;
     std::vector<int> getAdjacentFaces() const override;
+    std::span<const int> adjacentFaceSpan() const override;
+    std::span<const int> twinEdgeSpan() const override;
     int adjacentFaceIndex(int i) const override;
     std::ostream& print(std::ostream& os) const override;
     /// @}
 
-    std::vector<Point> vertices;      ///< Ordered vertices of the face
-    std::vector<int> adjacentFaces;   ///< Indices of adjacent faces for each edge
-    bool isOuter = false;            ///< Flag indicating if this is the outer face (boundary)
+    /**
+     * @brief Gets a vertex in the kernel it is stored in, without conversion.
+     * @param i Index of the vertex (0 <= i < vertexCount())
+     * @return Const reference to the stored vertex
+     */
+    const KernelPoint& point(size_t i) const;
 
-private:
-    // Note: Implementation details would go here if there were any private members
+    /**
+     * @brief Gets all vertices in the kernel they are stored in, without copying them.
+     * @return View of the vertices, valid as long as the face exists and is not modified
+     */
+    std::span<const KernelPoint> vertexSpan() const;
+
+    std::vector<KernelPoint> vertices;  ///< Ordered vertices of the face
+    std::vector<int> adjacentFaces;     ///< Indices of adjacent faces for each edge
+    std::vector<int> twinEdges;         ///< Index of each edge in the adjacent face; empty if unknown
+    bool isOuter = false;               ///< Flag indicating if this is the outer face (boundary)
 };
 
-} // namespace OneCut
\ No newline at end of file
+extern template class BasicSkeletonFace<ExactKernel>;
+extern template class BasicSkeletonFace<FastKernel>;
+
+using SkeletonFace = BasicSkeletonFace<ExactKernel>;     ///< Face with exact vertices
+using FastSkeletonFace = BasicSkeletonFace<FastKernel>;  ///< Face with double vertices
+
+} // namespace OneCut
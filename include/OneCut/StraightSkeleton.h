@@ -1,5 +1,6 @@
 #pragma once
 
+#include <span>
 #include <unordered_map>
 #include <vector>
 
@@ -46,10 +47,17 @@ class StraightSkeleton : public IStraightSkeleton {
      * @brief Gets a copy of all faces in the skeleton.
      * @return Vector containing copies of all SkeletonFace objects
      * @note This returns copies rather than references for safe usage when
-     *       the original skeleton might be destroyed
+     *       the original skeleton might be destroyed. Kept for compatibility;
+     *       read-only callers should use faceSpan().
      */
     std::vector<SkeletonFace> getFaces() const;
 
+    /**
+     * @brief Gets all faces without copying them.
+     * @return View of the faces, valid as long as the skeleton exists
+     */
+    std::span<const SkeletonFace> faceSpan() const;
+
    private:
     std::vector<SkeletonFace> faces; ///< Storage for all faces composing the skeleton
 };
@@ -2,12 +2,15 @@
 
 #include <CGAL/Exact_predicates_exact_constructions_kernel.h>
 #include <CGAL/Exact_predicates_exact_constructions_kernel_with_sqrt.h>
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
 #include <CGAL/Line_2.h>
 #include <CGAL/Point_2.h>
 #include <CGAL/Surface_mesh.h>
 #include <CGAL/intersections.h>
 #include <CGAL/squared_distance_2.h>
 
+#include <type_traits>
+
 /**
  * @namespace OneCut
  * @brief Contains type aliases for CGAL geometric primitives and data structures.
@@ -24,7 +27,20 @@ namespace OneCut {
  * Uses CGAL's exact predicates and exact constructions kernel with sqrt operations.
  * Ensures robust geometric computations without floating-point errors.
  */
-using K = CGAL::Exact_predicates_exact_constructions_kernel_with_sqrt;
+using ExactKernel = CGAL::Exact_predicates_exact_constructions_kernel_with_sqrt;
+
+/**
+ * @brief Kernel with exact predicates and double constructions.
+ *
+ * Used by the fast path of the perpendicular computation, whose results are rounded
+ * to doubles anyway. The templated geometry classes are instantiated for both kernels.
+ */
+using FastKernel = CGAL::Exact_predicates_inexact_constructions_kernel;
+
+/**
+ * @brief Kernel of the public point types (creases, skeleton faces).
+ */
+using K = ExactKernel;
 
 /// @name Geometric Primitives
 /// @{
@@ -50,4 +66,19 @@ using EdgeIndex = PlanarGraph::Edge_index;       ///< Index type for edges in th
 using HalfedgeIndex = PlanarGraph::Halfedge_index;  ///< Index type for halfedges in the graph
 /// @}
 
+/**
+ * @brief Converts a point to the point type of another kernel.
+ * @tparam TargetKernel Kernel of the returned point
+ * @param point Point of any CGAL kernel
+ * @return The same point if the kernels match, otherwise a point with the coordinates rounded to doubles
+ */
+template <class TargetKernel, class SourcePoint>
+typename TargetKernel::Point_2 convertPoint(const SourcePoint& point) {
+    if constexpr (std::is_same_v<SourcePoint, typename TargetKernel::Point_2>) {
+        return point;
+    } else {
+        return typename TargetKernel::Point_2(CGAL::to_double(point.x()), CGAL::to_double(point.y()));
+    }
+}
+
 }  // namespace OneCut
\ No newline at end of file
@@ -0,0 +1,168 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace OneCut {
+
+/**
+ * @struct TraceEvent
+ * @brief One completed span of a trace.
+ */
+struct TraceEvent {
+    std::string name;      ///< Name shown on the span
+    std::string category;  ///< Category, e.g. "skeleton" or "perpendiculars"
+    double startUs = 0;    ///< Start in microseconds since the tracer was created
+    double durationUs = 0; ///< Duration in microseconds
+    int threadId = 0;      ///< Small id of the recording thread, numbered from 1 in order of appearance
+    std::vector<std::pair<std::string, std::string>> args;  ///< Key and JSON-encoded value of every argument
+};
+
+/**
+ * @class Tracer
+ * @brief Collects the spans of crease computations and writes them as Chrome trace-event JSON.
+ *
+ * Tracing is opt-in and process-wide, like the diagnostic sink: spans are only recorded while a
+ * tracer is installed. Without one, a TraceSpan costs a single atomic load and never reads the
+ * clock. The output loads in chrome://tracing and https://ui.perfetto.dev.
+ *
+ * Usage:
+ * @code
+ * auto tracer = std::make_shared<Tracer>();
+ * Tracer::install(tracer);
+ * FoldManager::computeBatch(polygons);
+ * Tracer::install(nullptr);
+ * tracer->writeFile("trace.json");
+ * @endcode
+ *
+ * Recording is thread-safe. The installation and every running span share ownership of the
+ * tracer, so it stays alive until the last span that started while it was installed has ended.
+ */
+class Tracer {
+   public:
+    /**
+     * @brief Constructs an empty tracer; event times are relative to its construction.
+     */
+    Tracer();
+
+    /**
+     * @brief Installs the tracer receiving all spans of the process.
+     * @param tracer The new tracer; nullptr stops tracing
+     */
+    static void install(std::shared_ptr<Tracer> tracer);
+
+    /**
+     * @brief Gets the installed tracer.
+     * @return Shared ownership of the tracer, or nullptr if tracing is off
+     */
+    static std::shared_ptr<Tracer> active();
+
+    /**
+     * @brief Gets the time since construction.
+     * @return Microseconds since the tracer was created
+     */
+    double nowUs() const;
+
+    /**
+     * @brief Adds a completed span, stamped with the id of the calling thread.
+     * @param event The span; its threadId is overwritten
+     */
+    void record(TraceEvent event);
+
+    /**
+     * @brief Gets a copy of all spans recorded so far, in order of completion.
+     */
+    std::vector<TraceEvent> events() const;
+
+    /**
+     * @brief Removes all recorded spans.
+     */
+    void clear();
+
+    /**
+     * @brief Writes all spans as Chrome trace-event JSON ("X" events, one thread name per thread).
+     * @param os Destination of the JSON text
+     */
+    void write(std::ostream& os) const;
+
+    /**
+     * @brief Writes all spans as Chrome trace-event JSON to a file.
+     * @param path Destination path
+     * @throws std::runtime_error If the file cannot be written
+     */
+    void writeFile(const std::string& path) const;
+
+   private:
+    std::chrono::steady_clock::time_point origin;       ///< Time zero of the trace
+    mutable std::mutex mutex;                           ///< Guards events and threadIds
+    std::vector<TraceEvent> events_;                    ///< Recorded spans
+    std::unordered_map<std::thread::id, int> threadIds; ///< Small id per recording thread
+};
+
+/**
+ * @class TraceSpan
+ * @brief Records the time from its construction to finish() or its destruction in the installed Tracer.
+ *
+ * Does nothing if no tracer is installed at construction, so arguments should only be
+ * computed when enabled() is true if they are not free.
+ */
+class TraceSpan {
+   public:
+    /**
+     * @brief Starts a span.
+     * @param name Name of the span; must outlive the span
+     * @param category Category of the span; must outlive the span
+     */
+    TraceSpan(const char* name, const char* category)
+        : tracer(Tracer::active()), name(name), category(category) {
+        if (tracer) {
+            startUs = tracer->nowUs();
+        }
+    }
+
+    ~TraceSpan() { finish(); }
+
+    TraceSpan(const TraceSpan&) = delete;
+    TraceSpan& operator=(const TraceSpan&) = delete;
+
+    /**
+     * @brief Checks whether the span is recorded.
+     */
+    bool enabled() const { return static_cast<bool>(tracer); }
+
+    /**
+     * @brief Attaches an integer argument, shown in the details of the span.
+     */
+    void arg(const char* key, std::int64_t value) {
+        if (tracer) {
+            args.emplace_back(key, std::to_string(value));
+        }
+    }
+
+    /**
+     * @brief Attaches a string argument, shown in the details of the span.
+     */
+    void arg(const char* key, const std::string& value);
+
+    /**
+     * @brief Ends the span before its destruction; later calls do nothing.
+     */
+    void finish();
+
+   private:
+    std::shared_ptr<Tracer> tracer;  ///< Receives the span; nullptr if tracing was off at construction
+    const char* name;         ///< Name of the span
+    const char* category;     ///< Category of the span
+    double startUs = 0;       ///< Start, on the clock of the tracer
+    std::vector<std::pair<std::string, std::string>> args;  ///< Arguments, JSON-encoded
+};
+
+}  // namespace OneCut
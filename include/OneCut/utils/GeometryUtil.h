@@ -5,15 +5,21 @@
 namespace OneCut {
 
 /**
- * @class GeometryUtil
+ * @class BasicGeometryUtil
  * @brief Provides utility functions for 2D geometric operations.
  *
  * This class contains static methods for common vector operations used
- * throughout the OneCut project. All operations use exact arithmetic
- * through CGAL's exact computation kernel.
+ * throughout the OneCut project. It is instantiated for the exact kernel
+ * (GeometryUtil) and for the fast inexact-construction kernel (FastGeometryUtil).
+ *
+ * @tparam Kernel CGAL kernel providing the vector and number types
  */
-class GeometryUtil {
+template <class Kernel>
+class BasicGeometryUtil {
 public:
+    using Vector = typename Kernel::Vector_2;  ///< Vector type of the kernel
+    using FT = typename Kernel::FT;            ///< Number type of the kernel
+
     /**
      * @brief Rotates a vector 90 degrees counterclockwise.
      * @param v The input vector to rotate
@@ -36,7 +42,7 @@ public:
      * @return The signed magnitude of the cross product (a.x*b.y - a.y*b.x)
      * @note This returns a scalar value representing the "z-component" in 3D
      */
-    static K::FT cross(const Vector& a, const Vector& b);
+    static FT cross(const Vector& a, const Vector& b);
 
     /**
      * @brief Computes the scalar projection of a onto b.
@@ -45,7 +51,13 @@ public:
      * @return The signed length of a's projection onto b
      * @note Equivalent to |a|*cos(θ) where θ is the angle between vectors
      */
-    static K::FT scalarProjection(const Vector& a, const Vector& b);
+    static FT scalarProjection(const Vector& a, const Vector& b);
 };
 
-}  // namespace OneCut
\ No newline at end of file
+extern template class BasicGeometryUtil<ExactKernel>;
+extern template class BasicGeometryUtil<FastKernel>;
+
+using GeometryUtil = BasicGeometryUtil<ExactKernel>;     ///< Geometry utilities with exact arithmetic
+using FastGeometryUtil = BasicGeometryUtil<FastKernel>;  ///< Geometry utilities with double constructions
+
+}  // namespace OneCut
@@ -18,14 +18,21 @@ struct IntersectionResult {
 };
 
 /**
- * @class IntersectionUtil
- * @brief Provides exact geometric intersection operations.
+ * @class BasicIntersectionUtil
+ * @brief Provides geometric intersection operations.
  *
  * This class contains static methods for computing intersections between
- * geometric primitives using exact arithmetic.
+ * geometric primitives. IntersectionUtil uses exact arithmetic, FastIntersectionUtil
+ * the inexact-construction kernel.
+ *
+ * @tparam Kernel CGAL kernel providing the point and vector types
  */
-class IntersectionUtil {
+template <class Kernel>
+class BasicIntersectionUtil {
 public:
+    using Point = typename Kernel::Point_2;    ///< Point type of the kernel
+    using Vector = typename Kernel::Vector_2;  ///< Vector type of the kernel
+
     /**
      * @brief Computes the intersection between a ray and a line segment.
      * @param origin Starting point of the ray
@@ -47,6 +54,27 @@ public:
         const Vector& direction,
         const Point& segmentStart,
         const Point& segmentEnd);
+
+    /**
+     * @brief Computes the intersection between a ray and a segment given by start point and direction.
+     * @param origin Starting point of the ray
+     * @param direction Direction vector of the ray (does not need to be normalized)
+     * @param edgeStart Starting point of the segment
+     * @param edgeVector Vector from the start to the end point of the segment
+     * @return Same as intersectRaySegment(origin, direction, edgeStart, edgeStart + edgeVector)
+     * @note Lets callers reuse precomputed edge vectors instead of constructing them per ray.
+     */
+    static IntersectionResult intersectRayEdge(
+        const Point& origin,
+        const Vector& direction,
+        const Point& edgeStart,
+        const Vector& edgeVector);
 };
 
-}  // namespace OneCut
\ No newline at end of file
+extern template class BasicIntersectionUtil<ExactKernel>;
+extern template class BasicIntersectionUtil<FastKernel>;
+
+using IntersectionUtil = BasicIntersectionUtil<ExactKernel>;     ///< Intersections with exact arithmetic
+using FastIntersectionUtil = BasicIntersectionUtil<FastKernel>;  ///< Intersections with double constructions
+
+}  // namespace OneCut
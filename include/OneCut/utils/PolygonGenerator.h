@@ -0,0 +1,111 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "OneCut/SkeletonBuilder.h"
+
+namespace OneCut {
+
+/**
+ * @class PolygonGenerator
+ * @brief Generates families of simple polygons of arbitrary size.
+ *
+ * The generated polygons are counter-clockwise oriented and fit into the
+ * default Paper, so that every stage of the
+ * pipeline is exercised. They are meant as inputs for benchmarks and tests.
+ */
+class PolygonGenerator {
+public:
+    /// Center of the generated polygons (x and y)
+    static constexpr double CENTER = 300.0;
+    /// Radius of the circle all generated polygons fit into
+    static constexpr double RADIUS = 250.0;
+
+    /**
+     * @brief Generates a regular convex polygon.
+     * @param n Number of vertices (n >= 3)
+     * @return The polygon vertices
+     */
+    static std::vector<SkeletonConstruction::Point> convex(int n);
+
+    /**
+     * @brief Generates a star polygon alternating between an outer and an inner radius.
+     * @param n Number of vertices (n >= 6, rounded down to an even count)
+     * @return The polygon vertices
+     */
+    static std::vector<SkeletonConstruction::Point> star(int n);
+
+    /**
+     * @brief Generates a band winding around the center as an Archimedean spiral.
+     * @param n Number of vertices (n >= 6, rounded down to an even count)
+     * @return The polygon vertices
+     */
+    static std::vector<SkeletonConstruction::Point> spiral(int n);
+
+    /**
+     * @brief Generates a comb: a rectangular base with rectangular teeth on top.
+     * @param n Number of vertices (n >= 8); the result has 4 * ((n - 4) / 4) + 4 vertices
+     * @return The polygon vertices
+     */
+    static std::vector<SkeletonConstruction::Point> comb(int n);
+
+    /**
+     * @brief Generates a random star-shaped simple polygon.
+     * @param n Number of vertices (n >= 3)
+     * @param seed Seed of the random number generator; equal seeds give equal polygons
+     * @return The polygon vertices
+     */
+    static std::vector<SkeletonConstruction::Point> randomSimple(int n, std::uint32_t seed);
+
+    /// @name Hard Inputs
+    /// Random polygons provoking the degenerate cases of the straight skeleton, for stress tests.
+    /// Like randomSimple(), they are star-shaped with respect to the center and therefore simple.
+    /// @{
+
+    /**
+     * @brief Generates a polygon whose every second vertex is reflex.
+     * @param n Number of vertices (n >= 6, rounded down to an even count)
+     * @param seed Seed of the random number generator
+     * @return The polygon vertices; spikes of random length alternate with deep notches
+     */
+    static std::vector<SkeletonConstruction::Point> reflex(int n, std::uint32_t seed);
+
+    /**
+     * @brief Generates a square whose sides are runs of almost collinear vertices.
+     * @param n Number of vertices (n >= 8, rounded down to a multiple of 4)
+     * @param seed Seed of the random number generator
+     * @return The polygon vertices; side vertices deviate from the side by at most 1e-3
+     */
+    static std::vector<SkeletonConstruction::Point> nearCollinear(int n, std::uint32_t seed);
+
+    /**
+     * @brief Generates a polygon with k-fold rotational symmetry, whose skeleton has simultaneous events.
+     * @param n Number of vertices; the result has k * max(n / k, 3) vertices for a random k in [2, 6]
+     * @param seed Seed of the random number generator
+     * @return The polygon vertices; a random radius pattern repeated k times around the center
+     */
+    static std::vector<SkeletonConstruction::Point> symmetric(int n, std::uint32_t seed);
+    /// @}
+
+    /**
+     * @brief Generates a polygon of the family with the given name.
+     * @param family One of "convex", "star", "spiral", "comb", "random", "reflex", "collinear"
+     *               or "symmetric"
+     * @param n Number of vertices
+     * @param seed Seed used by the random families
+     * @return The polygon vertices
+     * @throws std::invalid_argument If the family name is unknown
+     */
+    static std::vector<SkeletonConstruction::Point> generate(const std::string& family, int n,
+                                                             std::uint32_t seed = 0);
+
+    /**
+     * @brief Gets the names of all polygon families accepted by generate().
+     * @return The family names
+     */
+    static std::vector<std::string> families();
+};
+
+}  // namespace OneCut
@@ -0,0 +1,74 @@
+#pragma once
+
+#include <cstddef>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace OneCut {
+
+/**
+ * @brief Turns -0.0 into 0.0 and leaves every other value unchanged.
+ *
+ * Both compare equal but hash and serialize differently, so coordinates are passed through
+ * this before they are used as keys or written out.
+ */
+inline double canonicalZero(double value) {
+    return value + 0.0;
+}
+
+/**
+ * @class WeldGrid
+ * @brief Assigns indices to points, giving points within a tolerance of each other the same index.
+ *
+ * Vertices are bucketed into a grid with the tolerance as spacing. A new point is compared with
+ * the vertices of its own and the eight neighbouring cells, so two points within the tolerance
+ * are welded even if they fall on opposite sides of a cell border. A point is welded to the
+ * nearest vertex within the tolerance; that vertex keeps its coordinates. With a tolerance of 0
+ * only equal coordinates are welded.
+ */
+class WeldGrid {
+   public:
+    /**
+     * @brief Constructs an empty grid.
+     * @param tolerance Largest distance of welded points, 0 to weld equal coordinates only
+     */
+    explicit WeldGrid(double tolerance = 0);
+
+    /**
+     * @brief Finds the vertex a point is welded to, or adds the point as a new vertex.
+     * @return Index of the vertex, numbered from 0 in order of addition, and true if it was added
+     */
+    std::pair<int, bool> insert(double x, double y);
+
+    /**
+     * @brief Gets the number of distinct vertices.
+     */
+    size_t size() const { return coordinates.size() / 2; }
+
+    /**
+     * @brief Reserves space for the given number of vertices.
+     */
+    void reserve(size_t vertexCount);
+
+    /**
+     * @brief Removes all vertices.
+     */
+    void clear();
+
+   private:
+    struct CellHash {
+        size_t operator()(const std::pair<long long, long long>& cell) const;
+    };
+    struct CoordinateHash {
+        size_t operator()(const std::pair<double, double>& coordinates) const;
+    };
+
+    double tolerance;                 ///< Largest distance of welded points
+    std::vector<double> coordinates;  ///< Interleaved x and y of every vertex
+    std::vector<int> nextInCell;      ///< Next vertex of the same cell per vertex, -1 at the end
+    std::unordered_map<std::pair<long long, long long>, int, CellHash> cellHeads;       ///< Last vertex per cell
+    std::unordered_map<std::pair<double, double>, int, CoordinateHash> exactVertices;  ///< Used for tolerance 0
+};
+
+}  // namespace OneCut
@@ -1,7 +1,9 @@
 import tkinter as tk
+import numpy as np
+import one_cut
+from one_cut import FoldType
 from tkinter import filedialog, messagebox
 from utils.fold_file_manager import FoldFileManager
-from utils.fold_format import FOLDFormat
 from models.polygon_model import PolygonModel
 from utils.canvas_export import CanvasExport
 
@@ -121,68 +123,17 @@ class FileController:
             self._save_fold_data(canvas_view, filename)
 
     def _save_fold_data(self, canvas_view, filename: str) -> None:
-        fold_data = self._generate_fold_data(canvas_view)
-        if fold_data:
-            FoldFileManager.write_fold_file(filename, fold_data)
-            messagebox.showinfo("Success", "File saved successfully.")
-        else:
-            messagebox.showerror("Error", "No polygon to save.")
-
-    def _generate_fold_data(self, canvas_view) -> dict:
-        fold = FOLDFormat()
         polygon_controller = canvas_view.app.polygon_controller
         if not polygon_controller.polygons:
-            return None
+            messagebox.showerror("Error", "No polygon to save.")
+            return
 
+        # The JSON is streamed by the C++ writer instead of being built in Python
         polygon = polygon_controller.polygons[0]
-        vertices = polygon.points.copy()
-        vertex_set = {(x, y) for x, y in vertices}
-
-        # Collect crease points
-        crease_points = []
-        for mountain in polygon.mountain_line_ids:
-            x1, y1, x2, y2 = mountain["coords"]
-            crease_points.extend([(x1, y1), (x2, y2)])
-        for valley in polygon.valley_line_ids:
-            x1, y1, x2, y2 = valley["coords"]
-            crease_points.extend([(x1, y1), (x2, y2)])
-
-        # Add unique crease points to vertices
-        for point in crease_points:
-            if point not in vertex_set:
-                vertices.append(point)
-                vertex_set.add(point)
-
-        # Populate FOLD data
-        fold.file_author = "User"  # Customize as needed
-        fold.file_classes = ["foldedForm"]
-        fold.vertices_coords = [[x, y] for x, y in vertices]
-        fold.faces_vertices = [list(range(len(polygon.points)))]
-
-        # Add edges (boundary and creases)
-        edges = []
-        edges_assignment = []
-        n = len(polygon.points)
-        for i in range(n):
-            edges.append([i, (i+1) % n])
-            edges_assignment.append("B")
-
-        # Add creases
-        def add_edges(creases, assign):
-            for crease in creases:
-                x1, y1, x2, y2 = crease["coords"]
-                try:
-                    idx1 = vertices.index((x1, y1))
-                    idx2 = vertices.index((x2, y2))
-                except ValueError:
-                    continue
-                edges.append([idx1, idx2])
-                edges_assignment.append(assign)
-
-        add_edges(polygon.mountain_line_ids, "M")
-        add_edges(polygon.valley_line_ids, "V")
-
-        fold.edges_vertices = edges
-        fold.edges_assignment = edges_assignment
-
-        return fold.to_dict()
\ No newline at end of file
+        lines = polygon.mountain_line_ids + polygon.valley_line_ids
+        segments = np.array([line["coords"] for line in lines], dtype=np.float64).reshape(-1, 2, 2)
+        fold_types = np.array([int(FoldType.MOUNTAIN)] * len(polygon.mountain_line_ids)
+                              + [int(FoldType.VALLEY)] * len(polygon.valley_line_ids), dtype=np.int8)
+        one_cut.write_fold(filename, np.asarray(polygon.points, dtype=np.float64), segments, fold_types,
+                           author="User")
+        messagebox.showinfo("Success", "File saved successfully.")
@@ -1,5 +1,9 @@
+import numpy as np
 import one_cut
-from one_cut import Point, FoldManager, FoldType, Origin
+from one_cut import FoldType, Origin
+
+# Crease sets of recently computed polygons, shared by all models
+_crease_cache = one_cut.CreaseCache(256)
 
 class PolygonModel:
     """ 
@@ -72,24 +76,28 @@ class PolygonModel:
         @return True if creases generated successfully.
         """
         try:
-            points_obj = [Point(x,y) for x,y in self.points]
-            fold_manager = FoldManager(points_obj)
-            creases = fold_manager.get_creases()
+            # One NumPy conversion instead of a Python object and two calls per point; undo/redo
+            # and re-exports of an unchanged polygon are answered by the cache
+            arrays = _crease_cache.get_crease_arrays(np.asarray(self.points, dtype=np.float64))
+            coords = arrays["segments"].reshape(-1, 4).tolist()
+            fold_types = arrays["fold_type"].tolist()
+            origins = arrays["origin"].tolist()
             self.skeleton_line_ids = []
             self.perpendicular_line_ids = []
             self.mountain_line_ids = []
             self.valley_line_ids = []
-            if creases:
-                for crease in creases:
-                    src, tgt = crease.edge
-                    if crease.foldType == FoldType.MOUNTAIN:
-                        self.mountain_line_ids.append({"coords": (src.x(), src.y(), tgt.x(), tgt.y())})
-                    elif crease.foldType == FoldType.VALLEY:
-                        self.valley_line_ids.append({"coords": (src.x(), src.y(), tgt.x(), tgt.y())})
-                    if crease.origin == Origin.SKELETON:
-                        self.skeleton_line_ids.append({"coords": (src.x(), src.y(), tgt.x(), tgt.y())})
-                    elif crease.origin == Origin.PERPENDICULAR:
-                         self.perpendicular_line_ids.append({"coords": (src.x(), src.y(), tgt.x(), tgt.y())})
+            mountain, valley = int(FoldType.MOUNTAIN), int(FoldType.VALLEY)
+            skeleton, perpendicular = int(Origin.SKELETON), int(Origin.PERPENDICULAR)
+            for coord, fold_type, origin in zip(coords, fold_types, origins):
+                line = {"coords": tuple(coord)}
+                if fold_type == mountain:
+                    self.mountain_line_ids.append(line)
+                elif fold_type == valley:
+                    self.valley_line_ids.append(line)
+                if origin == skeleton:
+                    self.skeleton_line_ids.append(line)
+                elif origin == perpendicular:
+                    self.perpendicular_line_ids.append(line)
             return True
         except Exception as e:
             raise RuntimeError(f"Error retrieving creases: {e}")
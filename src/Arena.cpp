@@ -0,0 +1,42 @@
+#include "OneCut/Arena.h"
+
+namespace OneCut {
+
+namespace {
+
+thread_local std::pmr::memory_resource* currentResource = nullptr;
+
+}  // namespace
+
+Arena::Arena(size_t initialSize) : buffer(initialSize, std::pmr::new_delete_resource()) {}
+
+size_t Arena::bytesAllocated() const {
+    return allocated;
+}
+
+void* Arena::do_allocate(size_t bytes, size_t alignment) {
+    allocated += bytes;
+    return buffer.allocate(bytes, alignment);
+}
+
+void Arena::do_deallocate(void*, size_t, size_t) {
+    // Released together with the arena
+}
+
+bool Arena::do_is_equal(const std::pmr::memory_resource& other) const noexcept {
+    return this == &other;
+}
+
+ArenaScope::ArenaScope(std::pmr::memory_resource* resource) : previous(currentResource) {
+    currentResource = resource;
+}
+
+ArenaScope::~ArenaScope() {
+    currentResource = previous;
+}
+
+std::pmr::memory_resource* ArenaScope::current() {
+    return currentResource ? currentResource : std::pmr::new_delete_resource();
+}
+
+}  // namespace OneCut
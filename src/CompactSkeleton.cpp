@@ -0,0 +1,230 @@
+#include "OneCut/CompactSkeleton.h"
+
+namespace OneCut {
+
+CompactFace::CompactFace(const CompactSkeleton* skeleton, int index) : skeleton(skeleton), index(index) {}
+
+size_t CompactFace::vertexCount() const {
+    return skeleton->faceOffsets[index + 1] - skeleton->faceOffsets[index];
+}
+
+Point CompactFace::vertex(size_t i) const {
+    return Point(x(i), y(i));
+}
+
+std::vector<Point> CompactFace::getVertices() const {
+    std::vector<Point> vertices;
+    vertices.reserve(vertexCount());
+    for (size_t i = 0; i < vertexCount(); i++) {
+        vertices.push_back(vertex(i));
+    }
+    return vertices;
+}
+
+std::vector<int> CompactFace::getAdjacentFaces() const {
+    std::span<const int> adjacentFaces = adjacentFaceSpan();
+    return std::vector<int>(adjacentFaces.begin(), adjacentFaces.end());
+}
+
+std::span<const int> CompactFace::adjacentFaceSpan() const {
+    return std::span<const int>(skeleton->adjacency).subspan(skeleton->faceOffsets[index], vertexCount());
+}
+
+std::span<const int> CompactFace::twinEdgeSpan() const {
+    return std::span<const int>(skeleton->twinEdges).subspan(skeleton->faceOffsets[index], vertexCount());
+}
+
+int CompactFace::adjacentFaceIndex(int i) const {
+    return skeleton->adjacency[skeleton->faceOffsets[index] + i];
+}
+
+std::ostream& CompactFace::print(std::ostream& os) const {
+    os << "{ \"vertices\": [";
+    for (size_t i = 0; i < vertexCount(); ++i) {
+        os << x(i) << " " << y(i);
+        if (i != vertexCount() - 1)
+            os << ", ";
+    }
+    os << "], \"adjacentFaces\": [";
+    for (size_t i = 0; i < vertexCount(); ++i) {
+        os << adjacentFaceIndex(i);
+        if (i != vertexCount() - 1)
+            os << ", ";
+    }
+    os << "] }";
+    return os;
+}
+
+double CompactFace::x(size_t i) const {
+    return skeleton->coordinates[2 * (skeleton->faceOffsets[index] + i)];
+}
+
+double CompactFace::y(size_t i) const {
+    return skeleton->coordinates[2 * (skeleton->faceOffsets[index] + i) + 1];
+}
+
+std::span<const double> CompactFace::coordinateSpan() const {
+    return std::span<const double>(skeleton->coordinates).subspan(2 * skeleton->faceOffsets[index], 2 * vertexCount());
+}
+
+bool CompactFace::isOuter() const {
+    return skeleton->outerFlags[index] != 0;
+}
+
+CompactSkeleton::CompactSkeleton() : faceOffsets{0} {}
+
+CompactSkeleton::CompactSkeleton(const IStraightSkeleton& skeleton) : faceOffsets{0} {
+    for (size_t i = 0; i < skeleton.faceCount(); i++) {
+        const ISkeletonFace& face = skeleton.face(i);
+        std::span<const int> adjacentFaces = face.adjacentFaceSpan();
+        std::span<const int> faceTwinEdges = face.twinEdgeSpan();
+        const auto* skeletonFace = dynamic_cast<const SkeletonFace*>(&face);
+        for (size_t v = 0; v < face.vertexCount(); v++) {
+            Point p = skeletonFace != nullptr ? skeletonFace->point(v) : face.vertex(v);
+            addVertex(CGAL::to_double(p.x()), CGAL::to_double(p.y()), adjacentFaces[v],
+                      faceTwinEdges.empty() ? -1 : faceTwinEdges[v]);
+        }
+        closeFace(skeletonFace != nullptr && skeletonFace->isOuter);
+    }
+}
+
+CompactSkeleton::CompactSkeleton(const CompactSkeleton& other)
+    : faceOffsets(other.faceOffsets),
+      coordinates(other.coordinates),
+      adjacency(other.adjacency),
+      twinEdges(other.twinEdges),
+      outerFlags(other.outerFlags),
+      faces(other.faces) {
+    bindFaces();
+}
+
+CompactSkeleton::CompactSkeleton(CompactSkeleton&& other) noexcept
+    : faceOffsets(std::move(other.faceOffsets)),
+      coordinates(std::move(other.coordinates)),
+      adjacency(std::move(other.adjacency)),
+      twinEdges(std::move(other.twinEdges)),
+      outerFlags(std::move(other.outerFlags)),
+      faces(std::move(other.faces)) {
+    bindFaces();
+}
+
+CompactSkeleton& CompactSkeleton::operator=(const CompactSkeleton& other) {
+    if (this != &other) {
+        faceOffsets = other.faceOffsets;
+        coordinates = other.coordinates;
+        adjacency = other.adjacency;
+        twinEdges = other.twinEdges;
+        outerFlags = other.outerFlags;
+        faces = other.faces;
+        bindFaces();
+    }
+    return *this;
+}
+
+CompactSkeleton& CompactSkeleton::operator=(CompactSkeleton&& other) noexcept {
+    if (this != &other) {
+        faceOffsets = std::move(other.faceOffsets);
+        coordinates = std::move(other.coordinates);
+        adjacency = std::move(other.adjacency);
+        twinEdges = std::move(other.twinEdges);
+        outerFlags = std::move(other.outerFlags);
+        faces = std::move(other.faces);
+        bindFaces();
+    }
+    return *this;
+}
+
+size_t CompactSkeleton::faceCount() const {
+    return faces.size();
+}
+
+const CompactFace& CompactSkeleton::face(size_t i) const {
+    return faces[i];
+}
+
+void CompactSkeleton::reserve(size_t faceCapacity, size_t vertexCapacity) {
+    faceOffsets.reserve(faceCapacity + 1);
+    outerFlags.reserve(faceCapacity);
+    faces.reserve(faceCapacity);
+    coordinates.reserve(2 * vertexCapacity);
+    adjacency.reserve(vertexCapacity);
+    twinEdges.reserve(vertexCapacity);
+}
+
+void CompactSkeleton::addVertex(double x, double y, int adjacentFace, int twinEdge) {
+    coordinates.push_back(x);
+    coordinates.push_back(y);
+    adjacency.push_back(adjacentFace);
+    twinEdges.push_back(twinEdge);
+}
+
+void CompactSkeleton::closeFace(bool isOuter) {
+    faces.emplace_back(this, static_cast<int>(faces.size()));
+    faceOffsets.push_back(static_cast<int>(adjacency.size()));
+    outerFlags.push_back(isOuter ? 1 : 0);
+}
+
+void CompactSkeleton::append(const CompactSkeleton& other) {
+    int vertexOffset = adjacency.size();
+    for (size_t i = 1; i < other.faceOffsets.size(); i++) {
+        faceOffsets.push_back(vertexOffset + other.faceOffsets[i]);
+        faces.emplace_back(this, static_cast<int>(faces.size()));
+    }
+    coordinates.insert(coordinates.end(), other.coordinates.begin(), other.coordinates.end());
+    adjacency.insert(adjacency.end(), other.adjacency.begin(), other.adjacency.end());
+    twinEdges.insert(twinEdges.end(), other.twinEdges.begin(), other.twinEdges.end());
+    outerFlags.insert(outerFlags.end(), other.outerFlags.begin(), other.outerFlags.end());
+}
+
+void CompactSkeleton::setAdjacentFaceIndex(int faceIndex, int edgeIndex, int adjacentFace) {
+    adjacency[faceOffsets[faceIndex] + edgeIndex] = adjacentFace;
+}
+
+void CompactSkeleton::setTwinEdgeIndex(int faceIndex, int edgeIndex, int twinEdge) {
+    twinEdges[faceOffsets[faceIndex] + edgeIndex] = twinEdge;
+}
+
+size_t CompactSkeleton::vertexCount() const {
+    return adjacency.size();
+}
+
+std::vector<SkeletonFace> CompactSkeleton::toFaces() const {
+    std::vector<SkeletonFace> result;
+    result.reserve(faceCount());
+    for (const CompactFace& face : faces) {
+        SkeletonFace skeletonFace(face.getVertices(), face.getAdjacentFaces());
+        std::span<const int> faceTwinEdges = face.twinEdgeSpan();
+        skeletonFace.twinEdges.assign(faceTwinEdges.begin(), faceTwinEdges.end());
+        skeletonFace.isOuter = face.isOuter();
+        result.push_back(std::move(skeletonFace));
+    }
+    return result;
+}
+
+const std::vector<int>& CompactSkeleton::getFaceOffsets() const {
+    return faceOffsets;
+}
+
+const std::vector<double>& CompactSkeleton::getCoordinates() const {
+    return coordinates;
+}
+
+const std::vector<int>& CompactSkeleton::getAdjacency() const {
+    return adjacency;
+}
+
+const std::vector<int>& CompactSkeleton::getTwinEdges() const {
+    return twinEdges;
+}
+
+const std::vector<std::uint8_t>& CompactSkeleton::getOuterFlags() const {
+    return outerFlags;
+}
+
+void CompactSkeleton::bindFaces() {
+    for (CompactFace& face : faces) {
+        face.skeleton = this;
+    }
+}
+
+}  // namespace OneCut
@@ -0,0 +1,282 @@
+#include "OneCut/CreaseCache.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <system_error>
+#include <thread>
+
+#include "OneCut/utils/WeldGrid.h"
+
+namespace OneCut {
+
+namespace {
+
+constexpr std::uint32_t FILE_MAGIC = 0x5243434F;  // "OCCR"
+constexpr std::uint32_t FILE_VERSION = 4;
+
+template <class T>
+void appendBytes(std::vector<std::uint8_t>& bytes, const T& value) {
+    const auto* begin = reinterpret_cast<const std::uint8_t*>(&value);
+    bytes.insert(bytes.end(), begin, begin + sizeof(T));
+}
+
+// The options that change the result, as bytes
+std::vector<std::uint8_t> serializeOptions(const FoldOptions& options) {
+    std::vector<std::uint8_t> bytes;
+    appendBytes(bytes, static_cast<std::uint8_t>((options.interiorOnly ? 1 : 0) | (options.exactKernel ? 2 : 0)));
+    appendBytes(bytes, static_cast<std::int32_t>(options.chainBudget));
+    appendBytes(bytes, static_cast<std::uint64_t>(options.jobBudget));
+    appendBytes(bytes, static_cast<std::uint8_t>(options.paper ? 1 : 0));
+    if (options.paper) {
+        for (double border : {options.paper->xMin, options.paper->yMin, options.paper->xMax, options.paper->yMax}) {
+            appendBytes(bytes, canonicalZero(border));
+        }
+    }
+    return bytes;
+}
+
+// Interleaved coordinates of the ring, counter-clockwise and starting at the lexicographically smallest vertex.
+std::vector<double> canonicalRing(const std::vector<SkeletonConstruction::Point>& polygon) {
+    size_t n = polygon.size();
+    std::vector<double> ring(2 * n);
+    double doubleArea = 0;
+    size_t first = 0;
+    for (size_t i = 0; i < n; i++) {
+        const SkeletonConstruction::Point& p = polygon[i];
+        const SkeletonConstruction::Point& q = polygon[(i + 1) % n];
+        doubleArea += p.x() * q.y() - q.x() * p.y();
+        if (std::make_pair(p.x(), p.y()) < std::make_pair(polygon[first].x(), polygon[first].y())) {
+            first = i;
+        }
+    }
+
+    // Walk backwards from the smallest vertex for clockwise input
+    bool reverse = doubleArea < 0;
+    for (size_t k = 0; k < n; k++) {
+        size_t i = reverse ? (first + n - k) % n : (first + k) % n;
+        ring[2 * k] = canonicalZero(polygon[i].x());
+        ring[2 * k + 1] = canonicalZero(polygon[i].y());
+    }
+    return ring;
+}
+
+// 64-bit FNV-1a
+std::uint64_t hashBytes(std::uint64_t hash, const void* data, size_t size) {
+    const auto* bytes = static_cast<const unsigned char*>(data);
+    for (size_t i = 0; i < size; i++) {
+        hash ^= bytes[i];
+        hash *= 0x100000001b3ULL;
+    }
+    return hash;
+}
+
+std::uint64_t hashRing(const std::vector<double>& ring, const std::vector<std::uint8_t>& options) {
+    std::uint64_t hash = 0xcbf29ce484222325ULL;
+    hash = hashBytes(hash, options.data(), options.size());
+    return hashBytes(hash, ring.data(), ring.size() * sizeof(double));
+}
+
+template <class T>
+void writeValue(std::ostream& os, const T& value) {
+    os.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+template <class T>
+bool readValue(std::istream& is, T& value) {
+    return static_cast<bool>(is.read(reinterpret_cast<char*>(&value), sizeof(T)));
+}
+
+}  // namespace
+
+CreaseCache::CreaseCache(size_t capacity, const std::string& directory)
+    : capacity(std::max<size_t>(capacity, 1)), directory(directory) {
+    if (!directory.empty()) {
+        std::error_code error;
+        std::filesystem::create_directories(directory, error);
+    }
+}
+
+std::vector<Crease> CreaseCache::getCreases(const std::vector<SkeletonConstruction::Point>& polygon,
+                                            const FoldOptions& options) {
+    Entry entry;
+    entry.canonicalRing = canonicalRing(polygon);
+    entry.options = serializeOptions(options);
+    entry.key = hashRing(entry.canonicalRing, entry.options);
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto it = index.find(entry.key);
+        if (it != index.end() && it->second->canonicalRing == entry.canonicalRing &&
+            it->second->options == entry.options) {
+            stats.hits++;
+            entries.splice(entries.begin(), entries, it->second);
+            return it->second->creases;
+        }
+    }
+
+    bool fromDisk = !directory.empty() && readEntry(entryPath(entry.key), entry);
+    bool written = false;
+    if (!fromDisk) {
+        entry.creases = FoldManager(polygon, options).getCreases();
+        written = !directory.empty() && writeEntry(entryPath(entry.key), entry);
+    }
+
+    std::vector<Crease> creases = entry.creases;
+    std::lock_guard<std::mutex> lock(mutex);
+    if (fromDisk) {
+        stats.diskHits++;
+    } else {
+        stats.misses++;
+        stats.diskWrites += written ? 1 : 0;
+    }
+    insert(std::move(entry));
+    return creases;
+}
+
+std::uint64_t CreaseCache::polygonHash(const std::vector<SkeletonConstruction::Point>& polygon,
+                                       const FoldOptions& options) {
+    return hashRing(canonicalRing(polygon), serializeOptions(options));
+}
+
+CacheStats CreaseCache::getStats() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return stats;
+}
+
+size_t CreaseCache::size() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return entries.size();
+}
+
+void CreaseCache::clear() {
+    std::lock_guard<std::mutex> lock(mutex);
+    entries.clear();
+    index.clear();
+}
+
+void CreaseCache::insert(Entry entry) {
+    auto it = index.find(entry.key);
+    if (it != index.end()) {
+        // Computed concurrently, or a hash collision; the newer entry wins
+        entries.erase(it->second);
+        index.erase(it);
+    }
+
+    std::uint64_t key = entry.key;
+    entries.push_front(std::move(entry));
+    index[key] = entries.begin();
+
+    while (entries.size() > capacity) {
+        index.erase(entries.back().key);
+        entries.pop_back();
+        stats.evictions++;
+    }
+}
+
+std::string CreaseCache::entryPath(std::uint64_t key) const {
+    char name[32];
+    std::snprintf(name, sizeof(name), "%016llx.creases", static_cast<unsigned long long>(key));
+    return (std::filesystem::path(directory) / name).string();
+}
+
+bool CreaseCache::readEntry(const std::string& path, Entry& entry) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file) {
+        return false;
+    }
+
+    std::uint32_t magic = 0;
+    std::uint32_t version = 0;
+    std::uint32_t optionSize = 0;
+    if (!readValue(file, magic) || !readValue(file, version) || !readValue(file, optionSize) ||
+        magic != FILE_MAGIC || version != FILE_VERSION || optionSize != entry.options.size()) {
+        return false;
+    }
+    std::vector<std::uint8_t> options(optionSize);
+    std::uint64_t ringSize = 0;
+    if (!file.read(reinterpret_cast<char*>(options.data()), optionSize) || options != entry.options ||
+        !readValue(file, ringSize) || ringSize != entry.canonicalRing.size()) {
+        return false;
+    }
+    std::vector<double> ring(ringSize);
+    if (!file.read(reinterpret_cast<char*>(ring.data()), ringSize * sizeof(double)) || ring != entry.canonicalRing) {
+        return false;
+    }
+
+    std::uint64_t creaseCount = 0;
+    if (!readValue(file, creaseCount)) {
+        return false;
+    }
+    std::vector<Crease> creases;
+    creases.reserve(std::min<std::uint64_t>(creaseCount, 1 << 20));  // The count is not trusted
+    for (std::uint64_t i = 0; i < creaseCount; i++) {
+        double coordinates[4];
+        std::int8_t foldType = 0;
+        std::int8_t origin = 0;
+        std::int32_t faceIndex = 0;
+        std::int32_t edgeIndex = 0;
+        std::uint8_t isBoundaryEdge = 0;
+        if (!file.read(reinterpret_cast<char*>(coordinates), sizeof(coordinates)) || !readValue(file, foldType) ||
+            !readValue(file, origin) || !readValue(file, faceIndex) || !readValue(file, edgeIndex) ||
+            !readValue(file, isBoundaryEdge)) {
+            return false;
+        }
+        Crease crease;
+        crease.edge = std::make_pair(Point(coordinates[0], coordinates[1]), Point(coordinates[2], coordinates[3]));
+        crease.foldType = static_cast<FoldType>(foldType);
+        crease.origin = static_cast<Origin>(origin);
+        crease.faceIndex = faceIndex;
+        crease.edgeIndex = edgeIndex;
+        crease.isBoundaryEdge = isBoundaryEdge != 0;
+        creases.push_back(crease);
+    }
+
+    entry.creases = std::move(creases);
+    return true;
+}
+
+bool CreaseCache::writeEntry(const std::string& path, const Entry& entry) {
+    // Written next to the target under a per-thread name and renamed, so readers never see a partial file
+    size_t threadHash = std::hash<std::thread::id>()(std::this_thread::get_id());
+    std::string temporaryPath = path + ".tmp" + std::to_string(threadHash);
+    {
+        std::ofstream file(temporaryPath, std::ios::binary | std::ios::trunc);
+        if (!file) {
+            return false;
+        }
+        writeValue(file, FILE_MAGIC);
+        writeValue(file, FILE_VERSION);
+        writeValue(file, static_cast<std::uint32_t>(entry.options.size()));
+        file.write(reinterpret_cast<const char*>(entry.options.data()), entry.options.size());
+        writeValue(file, static_cast<std::uint64_t>(entry.canonicalRing.size()));
+        file.write(reinterpret_cast<const char*>(entry.canonicalRing.data()),
+                   entry.canonicalRing.size() * sizeof(double));
+        writeValue(file, static_cast<std::uint64_t>(entry.creases.size()));
+        for (const Crease& crease : entry.creases) {
+            double coordinates[4] = {CGAL::to_double(crease.edge.first.x()), CGAL::to_double(crease.edge.first.y()),
+                                     CGAL::to_double(crease.edge.second.x()), CGAL::to_double(crease.edge.second.y())};
+            file.write(reinterpret_cast<const char*>(coordinates), sizeof(coordinates));
+            writeValue(file, static_cast<std::int8_t>(crease.foldType));
+            writeValue(file, static_cast<std::int8_t>(crease.origin));
+            writeValue(file, static_cast<std::int32_t>(crease.faceIndex));
+            writeValue(file, static_cast<std::int32_t>(crease.edgeIndex));
+            writeValue(file, static_cast<std::uint8_t>(crease.isBoundaryEdge ? 1 : 0));
+        }
+        if (!file) {
+            return false;
+        }
+    }
+
+    std::error_code error;
+    std::filesystem::rename(temporaryPath, path, error);
+    if (error) {
+        std::filesystem::remove(temporaryPath, error);
+        return false;
+    }
+    return true;
+}
+
+}  // namespace OneCut
@@ -0,0 +1,46 @@
+#include "OneCut/CreasePattern.h"
+
+namespace OneCut {
+
+CreasePatternBuilder::CreasePatternBuilder(double weldTolerance) : weld(weldTolerance) {}
+
+int CreasePatternBuilder::addVertex(double x, double y) {
+    auto [index, inserted] = weld.insert(x, y);
+    if (inserted) {
+        pattern.vertexCoordinates.push_back(x);
+        pattern.vertexCoordinates.push_back(y);
+    }
+    return index;
+}
+
+bool CreasePatternBuilder::addCrease(int start, int end, FoldType foldType, Origin origin, int faceIndex) {
+    if (start == end) {
+        return false;
+    }
+    pattern.edgeVertices.push_back(start);
+    pattern.edgeVertices.push_back(end);
+    pattern.foldTypes.push_back(foldType);
+    pattern.origins.push_back(origin);
+    pattern.faceIndices.push_back(faceIndex);
+    return true;
+}
+
+CreasePattern CreasePatternBuilder::build() {
+    CreasePattern result = std::move(pattern);
+    pattern = CreasePattern();
+    weld.clear();
+    return result;
+}
+
+CreasePattern CreasePatternBuilder::fromCreases(const std::vector<Crease>& creases, double weldTolerance) {
+    CreasePatternBuilder builder(weldTolerance);
+    builder.weld.reserve(creases.size());
+    for (const Crease& crease : creases) {
+        int start = builder.addVertex(crease.edge.first);
+        int end = builder.addVertex(crease.edge.second);
+        builder.addCrease(start, end, crease.foldType, crease.origin, crease.faceIndex);
+    }
+    return builder.build();
+}
+
+}  // namespace OneCut
@@ -0,0 +1,33 @@
+#include "OneCut/Diagnostics.h"
+
+#include <atomic>
+#include <mutex>
+
+namespace OneCut {
+
+namespace {
+
+std::mutex sinkMutex;
+DiagnosticSink currentSink;
+std::atomic<bool> sinkInstalled{false};
+
+}  // namespace
+
+void Diagnostics::setSink(DiagnosticSink sink) {
+    std::lock_guard<std::mutex> lock(sinkMutex);
+    currentSink = std::move(sink);
+    sinkInstalled = static_cast<bool>(currentSink);
+}
+
+bool Diagnostics::hasSink() {
+    return sinkInstalled;
+}
+
+void Diagnostics::emit(const std::string& message) {
+    std::lock_guard<std::mutex> lock(sinkMutex);
+    if (currentSink) {
+        currentSink(message);
+    }
+}
+
+}  // namespace OneCut
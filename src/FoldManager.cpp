@@ -1,71 +1,259 @@
 #include "OneCut/FoldManager.h"
 
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <span>
+#include <stdexcept>
+#include <thread>
+
+#include "OneCut/Tracer.h"
+
 namespace OneCut {
 
-FoldManager::FoldManager(const std::vector<SkeletonConstruction::Point>& polygon)
-    : skeletonBuilder(SkeletonConstruction::SkeletonBuilder(polygon)),
-      skeleton(skeletonBuilder.buildSkeleton()),
-      perpendicularFinder(skeleton) {}
+namespace {
 
-std::vector<Crease> FoldManager::getCreases() {
-    std::vector<Crease> creases;
+// Scalar projection of the vector aStart->aEnd onto bStart->bEnd, evaluated in the given kernel.
+template <class Kernel>
+double scalarProjection(const FastKernel::Point_2& aStart, const FastKernel::Point_2& aEnd,
+                        const FastKernel::Point_2& bStart, const FastKernel::Point_2& bEnd) {
+    auto a = convertPoint<Kernel>(aEnd) - convertPoint<Kernel>(aStart);
+    auto b = convertPoint<Kernel>(bEnd) - convertPoint<Kernel>(bStart);
+    return CGAL::to_double(BasicGeometryUtil<Kernel>::scalarProjection(a, b));
+}
+
+// Computes one polygon of a batch; failures are recorded in the result instead of thrown
+FoldResult computeOne(const std::vector<SkeletonConstruction::Point>& polygon, const FoldOptions& options,
+                      size_t index) {
+    TraceSpan span("polygon", "batch");
+    span.arg("index", static_cast<std::int64_t>(index));
+    span.arg("vertices", static_cast<std::int64_t>(polygon.size()));
+    FoldResult result;
+    try {
+        if (polygon.size() < 3) {
+            throw std::invalid_argument("Polygon needs at least 3 vertices, got " + std::to_string(polygon.size()));
+        }
+        FoldManager foldManager(polygon, options);
+        result.creases = foldManager.getCreases(result.stats);
+    } catch (const std::exception& e) {
+        result.creases.clear();
+        result.error = e.what();
+    } catch (...) {
+        result.creases.clear();
+        result.error = "Unknown error";
+    }
+    if (!result.ok()) {
+        span.arg("error", result.error);
+    }
+    return result;
+}
+
+}  // namespace
+
+FoldManager::FoldManager(const std::vector<SkeletonConstruction::Point>& polygon, const FoldOptions& options)
+    : options(options),
+      skeletonBuilder(polygon, SkeletonConstruction::ExteriorMode::LAZY, options.paper),
+      skeleton(options.interiorOnly ? skeletonBuilder.buildCompactInteriorSkeleton()
+                                    : skeletonBuilder.buildCompactSkeleton()) {}
+
+FoldManager::FoldManager(const std::vector<SkeletonConstruction::Polygon_with_holes_2>& shapes,
+                         const FoldOptions& options)
+    : options(options),
+      skeletonBuilder(shapes, SkeletonConstruction::ExteriorMode::LAZY, options.paper),
+      skeleton(options.interiorOnly ? skeletonBuilder.buildCompactInteriorSkeleton()
+                                    : skeletonBuilder.buildCompactSkeleton()) {}
+
+template <class Visitor>
+void FoldManager::forEachSkeletonCrease(Visitor&& visit) const {
     for (int faceIndex = 0; faceIndex < skeleton.faceCount(); faceIndex++) {
-        for (int vertexIndex = 1; vertexIndex < skeleton.face(faceIndex).vertexCount(); vertexIndex++) {
-            auto adjacentFace = skeleton.face(faceIndex).adjacentFaces[vertexIndex];
-            auto fold = std::make_pair(
-                skeleton.face(faceIndex).vertices[vertexIndex],
-                skeleton.face(faceIndex).vertices[(vertexIndex + 1) % skeleton.face(faceIndex).vertexCount()]);
+        const CompactFace& face = skeleton.face(faceIndex);
+        size_t vertexCount = face.vertexCount();
+        std::span<const int> adjacentFaces = face.adjacentFaceSpan();
+
+        for (int vertexIndex = 1; vertexIndex < vertexCount; vertexIndex++) {
+            int adjacentFace = adjacentFaces[vertexIndex];
+            size_t endIndex = (vertexIndex + 1) % vertexCount;
+            FastKernel::Point_2 foldStart(face.x(vertexIndex), face.y(vertexIndex));
+            FastKernel::Point_2 foldEnd(face.x(endIndex), face.y(endIndex));
 
             // Only process each face pair once
             if (adjacentFace > faceIndex) {
-                Crease crease;
-                std::pair<Point, Point> adjacentFaceEdge =
-                    std::make_pair(skeleton.face(adjacentFace).vertices[0], skeleton.face(adjacentFace).vertices[1]);
-                std::pair<Point, Point> edge =
-                    std::make_pair(skeleton.face(faceIndex).vertices[0], skeleton.face(faceIndex).vertices[1]);
-
-                Vector adjVec = skeleton.face(adjacentFace).vertices[1] - skeleton.face(adjacentFace).vertices[0];
-                Vector foldVec = fold.second - fold.first;
+                const CompactFace& adjacent = skeleton.face(adjacentFace);
+                FastKernel::Point_2 adjacentStart(adjacent.x(0), adjacent.y(0));
+                FastKernel::Point_2 adjacentEnd(adjacent.x(1), adjacent.y(1));
 
                 // Project adjacent edge vector onto current edge vector to determine fold direction
-                auto projectionValue = GeometryUtil::scalarProjection(adjVec, foldVec);
+                double projectionValue =
+                    options.exactKernel
+                        ? scalarProjection<ExactKernel>(adjacentStart, adjacentEnd, foldStart, foldEnd)
+                        : scalarProjection<FastKernel>(adjacentStart, adjacentEnd, foldStart, foldEnd);
 
-                if (skeleton.face(faceIndex).isOuter) {
+                FoldType foldType;
+                if (face.isOuter()) {
                     if (projectionValue > -0.0001) {
-                        crease.foldType = FoldType::VALLEY;
+                        foldType = FoldType::VALLEY;
                     } else {
-                        crease.foldType = FoldType::MOUNTAIN;
+                        foldType = FoldType::MOUNTAIN;
                     }
                 } else {
                     if (projectionValue > -0.0001) {
-                        crease.foldType = FoldType::MOUNTAIN;
+                        foldType = FoldType::MOUNTAIN;
                     } else {
-                        crease.foldType = FoldType::VALLEY;
+                        foldType = FoldType::VALLEY;
                     }
                 }
 
-                crease.edge = fold;
-                crease.origin = Origin::SKELETON;
-                creases.push_back(crease);
+                visit(faceIndex, vertexIndex, foldStart, foldEnd, foldType);
             }
         }
     }
+}
+
+std::vector<Crease> FoldManager::getCreases() {
+    PipelineStats stats;
+    return getCreases(stats);
+}
+
+std::vector<Crease> FoldManager::getCreases(PipelineStats& stats) {
+    stats = skeletonBuilder.getStats();
+    StageTimer assemblyTimer;
+    TraceSpan span("crease assembly", "creases");
+
+    std::vector<Crease> creases;
+    forEachSkeletonCrease([&creases](int faceIndex, int edgeIndex, const FastKernel::Point_2& foldStart,
+                                     const FastKernel::Point_2& foldEnd, FoldType foldType) {
+        Crease crease;
+        // Crease edges are the only place the skeleton crease points are needed exactly
+        crease.edge = std::make_pair(convertPoint<ExactKernel>(foldStart), convertPoint<ExactKernel>(foldEnd));
+        crease.foldType = foldType;
+        crease.origin = Origin::SKELETON;
+        crease.faceIndex = faceIndex;
+        crease.edgeIndex = edgeIndex;
+        creases.push_back(crease);
+    });
 
-    // TODO: Tree structure? Dfs?
     // Add perpendicular creases; all valleys
-    std::vector<PerpChain> chains = perpendicularFinder.findPerpendiculars();
-    for (const auto& chain : chains) {
-        for (const auto& segment : chain) {
-            Crease crease;
-            crease.edge =
-                std::make_pair(Point(segment.start.x(), segment.start.y()), Point(segment.end.x(), segment.end.y()));
-            crease.foldType = FoldType::VALLEY;
-            crease.origin = Origin::PERPENDICULAR;
-            creases.push_back(crease);
-        }
+    if (options.exactKernel) {
+        addPerpendicularCreases<ExactKernel>(creases, stats);
+    } else {
+        addPerpendicularCreases<FastKernel>(creases, stats);
     }
 
+    stats.creaseAssemblyMs = assemblyTimer.elapsedMs() - stats.perpendicularsMs;
+    stats.creaseCount = creases.size();
+    span.arg("creases", static_cast<std::int64_t>(stats.creaseCount));
+    stats.totalMs += stats.perpendicularsMs + stats.creaseAssemblyMs;
     return creases;
 }
 
+CreasePattern FoldManager::getCreasePattern(double weldTolerance) {
+    PipelineStats stats;
+    return getCreasePattern(stats, weldTolerance);
+}
+
+CreasePattern FoldManager::getCreasePattern(PipelineStats& stats, double weldTolerance) {
+    stats = skeletonBuilder.getStats();
+    StageTimer assemblyTimer;
+    TraceSpan span("crease assembly", "creases");
+
+    CreasePatternBuilder builder(weldTolerance);
+    forEachSkeletonCrease([&builder](int faceIndex, int, const FastKernel::Point_2& foldStart,
+                                     const FastKernel::Point_2& foldEnd, FoldType foldType) {
+        builder.addCrease(builder.addVertex(foldStart), builder.addVertex(foldEnd), foldType, Origin::SKELETON,
+                          faceIndex);
+    });
+
+    if (options.exactKernel) {
+        addPerpendicularCreases<ExactKernel>(builder, stats);
+    } else {
+        addPerpendicularCreases<FastKernel>(builder, stats);
+    }
+
+    CreasePattern pattern = builder.build();
+    stats.creaseAssemblyMs = assemblyTimer.elapsedMs() - stats.perpendicularsMs;
+    stats.creaseCount = pattern.creaseCount();
+    span.arg("creases", static_cast<std::int64_t>(stats.creaseCount));
+    stats.totalMs += stats.perpendicularsMs + stats.creaseAssemblyMs;
+    return pattern;
+}
+
+std::vector<FoldResult> FoldManager::computeBatch(
+    const std::vector<std::vector<SkeletonConstruction::Point>>& polygons, const FoldOptions& options,
+    int threadCount) {
+    std::vector<FoldResult> results(polygons.size());
+    size_t workerCount = threadCount > 0 ? threadCount : std::max(1u, std::thread::hardware_concurrency());
+    workerCount = std::min(workerCount, polygons.size());
+    if (workerCount <= 1) {
+        for (size_t i = 0; i < polygons.size(); i++) {
+            results[i] = computeOne(polygons[i], options, i);
+        }
+        return results;
+    }
+
+    // Polygons differ a lot in cost, so idle workers take the next one instead of a fixed share
+    std::atomic<size_t> nextPolygon{0};
+    auto work = [&]() {
+        for (size_t i = nextPolygon++; i < polygons.size(); i = nextPolygon++) {
+            results[i] = computeOne(polygons[i], options, i);
+        }
+    };
+
+    std::vector<std::thread> workers;
+    workers.reserve(workerCount - 1);
+    for (size_t worker = 1; worker < workerCount; worker++) {
+        workers.emplace_back(work);
+    }
+    work();
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+    return results;
+}
+
+template <class Kernel>
+BasicPerpGraph<Kernel> FoldManager::perpendicularGraph(PipelineStats& stats) const {
+    BasicPerpendicularFinder<Kernel> perpendicularFinder(skeleton);
+    perpendicularFinder.setThreadCount(options.threadCount);
+    perpendicularFinder.setChainBudget(options.chainBudget);
+    perpendicularFinder.setJobBudget(options.jobBudget);
+    perpendicularFinder.setPaper(options.paper.value_or(Paper()));
+    // The graph holds every shared point and segment once, so no crease is emitted twice
+    return perpendicularFinder.findPerpendicularGraph(stats);
+}
+
+template <class Kernel>
+void FoldManager::addPerpendicularCreases(std::vector<Crease>& creases, PipelineStats& stats) const {
+    BasicPerpGraph<Kernel> graph = perpendicularGraph<Kernel>(stats);
+    std::vector<Point> vertices;
+    vertices.reserve(graph.vertices.size());
+    for (const auto& vertex : graph.vertices) {
+        vertices.push_back(convertPoint<ExactKernel>(vertex));
+    }
+    creases.reserve(creases.size() + graph.segments.size());
+    for (const PerpGraphSegment& segment : graph.segments) {
+        Crease crease;
+        crease.edge = std::make_pair(vertices[segment.start], vertices[segment.end]);
+        crease.foldType = FoldType::VALLEY;
+        crease.origin = Origin::PERPENDICULAR;
+        crease.faceIndex = segment.faceIndex;
+        creases.push_back(crease);
+    }
+}
+
+template <class Kernel>
+void FoldManager::addPerpendicularCreases(CreasePatternBuilder& builder, PipelineStats& stats) const {
+    BasicPerpGraph<Kernel> graph = perpendicularGraph<Kernel>(stats);
+
+    // Graph vertices are distinct already, so each one is welded once instead of once per segment
+    std::vector<int> vertexIndices;
+    vertexIndices.reserve(graph.vertices.size());
+    for (const auto& vertex : graph.vertices) {
+        vertexIndices.push_back(builder.addVertex(vertex));
+    }
+    for (const PerpGraphSegment& segment : graph.segments) {
+        builder.addCrease(vertexIndices[segment.start], vertexIndices[segment.end], FoldType::VALLEY,
+                          Origin::PERPENDICULAR, segment.faceIndex);
+    }
+}
+
 }  // namespace OneCut
@@ -0,0 +1,321 @@
+#include "OneCut/FoldReader.h"
+
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <stdexcept>
+
+#if defined(_WIN32)
+#include <fstream>
+#include <iterator>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace OneCut {
+
+namespace {
+
+/**
+ * Read-only view of a whole file: memory-mapped where mmap is available, read into memory otherwise.
+ */
+class MappedFile {
+   public:
+    explicit MappedFile(const std::string& path) {
+#if defined(_WIN32)
+        std::ifstream file(path, std::ios::binary);
+        if (!file) {
+            throw std::runtime_error("Cannot open " + path);
+        }
+        buffer.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+        view = buffer;
+#else
+        int descriptor = ::open(path.c_str(), O_RDONLY);
+        if (descriptor < 0) {
+            throw std::runtime_error("Cannot open " + path);
+        }
+        struct stat status;
+        if (::fstat(descriptor, &status) != 0) {
+            ::close(descriptor);
+            throw std::runtime_error("Cannot read " + path);
+        }
+        size = static_cast<size_t>(status.st_size);
+        if (size > 0) {
+            data = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, descriptor, 0);
+            if (data == MAP_FAILED) {
+                ::close(descriptor);
+                throw std::runtime_error("Cannot map " + path);
+            }
+            // The file is read front to back exactly once
+            ::madvise(data, size, MADV_SEQUENTIAL);
+            view = std::string_view(static_cast<const char*>(data), size);
+        }
+        ::close(descriptor);
+#endif
+    }
+
+    ~MappedFile() {
+#if !defined(_WIN32)
+        if (size > 0) {
+            ::munmap(data, size);
+        }
+#endif
+    }
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    std::string_view text() const { return view; }
+
+   private:
+    std::string_view view;
+#if defined(_WIN32)
+    std::string buffer;
+#else
+    void* data = nullptr;
+    size_t size = 0;
+#endif
+};
+
+/**
+ * Forward-only JSON scanner over a text buffer; values are parsed where they are, without a document.
+ */
+class JsonScanner {
+   public:
+    explicit JsonScanner(std::string_view text) : text(text) {}
+
+    // Skips whitespace; consumes c and returns true if it is the next character
+    bool consume(char c) {
+        skipWhitespace();
+        if (position < text.size() && text[position] == c) {
+            position++;
+            return true;
+        }
+        return false;
+    }
+
+    void expect(char c) {
+        if (!consume(c)) {
+            fail(std::string("expected '") + c + "'");
+        }
+    }
+
+    // Contents of a string without unescaping; keys and assignments of FOLD files need none
+    std::string_view readString() {
+        expect('"');
+        size_t start = position;
+        while (position < text.size() && text[position] != '"') {
+            position += text[position] == '\\' ? 2 : 1;
+        }
+        if (position >= text.size()) {
+            fail("unterminated string");
+        }
+        return text.substr(start, position++ - start);
+    }
+
+    double readNumber() {
+        skipWhitespace();
+        double value = 0;
+        auto result = std::from_chars(text.data() + position, text.data() + text.size(), value);
+        if (result.ec != std::errc()) {
+            fail("expected a number");
+        }
+        position = result.ptr - text.data();
+        return value;
+    }
+
+    // Calls element() for every element of an array
+    template <class Element>
+    void readArray(Element&& element) {
+        expect('[');
+        if (consume(']')) {
+            return;
+        }
+        do {
+            element();
+        } while (consume(','));
+        expect(']');
+    }
+
+    // Skips one value of any type, including nested arrays and objects
+    void skipValue() {
+        skipWhitespace();
+        int depth = 0;
+        do {
+            if (position >= text.size()) {
+                fail("unexpected end of input");
+            }
+            char c = text[position];
+            if (c == '"') {
+                readString();
+            } else {
+                if (c == '[' || c == '{') {
+                    depth++;
+                } else if (c == ']' || c == '}') {
+                    depth--;
+                }
+                position++;
+                // Scalars end at the next delimiter
+                while (depth == 0 && position < text.size() && !isDelimiter(text[position])) {
+                    position++;
+                }
+            }
+            skipWhitespace();
+        } while (depth > 0);
+    }
+
+    [[noreturn]] void fail(const std::string& message) const {
+        throw std::runtime_error("Invalid FOLD JSON at offset " + std::to_string(position) + ": " + message);
+    }
+
+   private:
+    std::string_view text;
+    size_t position = 0;
+
+    static bool isDelimiter(char c) {
+        return c == ',' || c == ']' || c == '}' || c == ' ' || c == '\n' || c == '\r' || c == '\t';
+    }
+
+    void skipWhitespace() {
+        while (position < text.size() &&
+               (text[position] == ' ' || text[position] == '\n' || text[position] == '\r' || text[position] == '\t')) {
+            position++;
+        }
+    }
+};
+
+}  // namespace
+
+FoldData FoldReader::read(const std::string& path) {
+    MappedFile file(path);
+    return parse(file.text());
+}
+
+FoldData FoldReader::parse(std::string_view json) {
+    FoldData data;
+    JsonScanner scanner(json);
+
+    scanner.expect('{');
+    if (scanner.consume('}')) {
+        return data;
+    }
+    do {
+        std::string_view key = scanner.readString();
+        scanner.expect(':');
+        if (key == "vertices_coords") {
+            scanner.readArray([&]() {
+                int coordinate = 0;
+                scanner.readArray([&]() {
+                    double value = scanner.readNumber();
+                    if (coordinate++ < 2) {
+                        data.vertexCoordinates.push_back(value);
+                    }
+                });
+                if (coordinate < 2) {
+                    scanner.fail("vertex with fewer than 2 coordinates");
+                }
+            });
+        } else if (key == "edges_vertices") {
+            scanner.readArray([&]() {
+                int count = 0;
+                scanner.readArray([&]() {
+                    data.edgeVertices.push_back(static_cast<int>(scanner.readNumber()));
+                    count++;
+                });
+                if (count != 2) {
+                    scanner.fail("edge without exactly 2 vertices");
+                }
+            });
+        } else if (key == "edges_assignment") {
+            scanner.readArray([&]() {
+                std::string_view assignment = scanner.readString();
+                data.edgeAssignments.push_back(assignment.empty() ? 'U' : assignment[0]);
+            });
+        } else if (key == "faces_vertices") {
+            scanner.readArray([&]() {
+                std::vector<int>& face = data.faces.emplace_back();
+                scanner.readArray([&]() { face.push_back(static_cast<int>(scanner.readNumber())); });
+            });
+        } else {
+            scanner.skipValue();
+        }
+    } while (scanner.consume(','));
+    scanner.expect('}');
+    return data;
+}
+
+std::vector<std::vector<SkeletonConstruction::Point>> FoldData::boundaryPolygons() const {
+    std::vector<std::vector<SkeletonConstruction::Point>> polygons;
+    int n = static_cast<int>(vertexCount());
+    auto point = [this](int v) {
+        return SkeletonConstruction::Point(vertexCoordinates[2 * v], vertexCoordinates[2 * v + 1]);
+    };
+
+    size_t edgeCount = edgeVertices.size() / 2;
+    if (edgeAssignments.size() != edgeCount || edgeAssignments.find('B') == std::string::npos) {
+        for (const std::vector<int>& face : faces) {
+            if (std::all_of(face.begin(), face.end(), [n](int v) { return v >= 0 && v < n; })) {
+                std::vector<SkeletonConstruction::Point>& polygon = polygons.emplace_back();
+                for (int v : face) {
+                    polygon.push_back(point(v));
+                }
+            }
+        }
+        return polygons;
+    }
+
+    // Up to two boundary neighbours per vertex; a third one marks the vertex as not on a simple ring
+    std::vector<std::array<int, 2>> neighbours(n, {-1, -1});
+    std::vector<int> degree(n, 0);
+    for (size_t e = 0; e < edgeCount; e++) {
+        int a = edgeVertices[2 * e];
+        int b = edgeVertices[2 * e + 1];
+        if (edgeAssignments[e] != 'B' || a < 0 || b < 0 || a >= n || b >= n || a == b) {
+            continue;
+        }
+        for (auto [from, to] : {std::make_pair(a, b), std::make_pair(b, a)}) {
+            if (degree[from] < 2) {
+                neighbours[from][degree[from]] = to;
+            }
+            degree[from]++;
+        }
+    }
+
+    std::vector<bool> visited(n, false);
+    for (int start = 0; start < n; start++) {
+        if (visited[start] || degree[start] == 0) {
+            continue;
+        }
+
+        // Walk the ring, never going back to the vertex just left
+        std::vector<int> ring;
+        bool closed = false;
+        int previous = -1;
+        int current = start;
+        while (!visited[current]) {
+            visited[current] = true;
+            ring.push_back(current);
+            if (degree[current] != 2) {
+                break;
+            }
+            int next = neighbours[current][0] != previous ? neighbours[current][0] : neighbours[current][1];
+            previous = current;
+            current = next;
+            closed = current == start;
+        }
+
+        if (closed && ring.size() >= 3) {
+            std::vector<SkeletonConstruction::Point>& polygon = polygons.emplace_back();
+            polygon.reserve(ring.size());
+            for (int v : ring) {
+                polygon.push_back(point(v));
+            }
+        }
+    }
+    return polygons;
+}
+
+}  // namespace OneCut
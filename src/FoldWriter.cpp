@@ -0,0 +1,177 @@
+#include "OneCut/FoldWriter.h"
+
+#include <algorithm>
+#include <charconv>
+#include <fstream>
+#include <optional>
+#include <stdexcept>
+
+#include "OneCut/utils/WeldGrid.h"
+
+namespace OneCut {
+
+namespace {
+
+// Shortest representation that reads back as the same double
+void writeNumber(std::ostream& os, double value) {
+    char buffer[32];
+    auto result = std::to_chars(buffer, buffer + sizeof(buffer), canonicalZero(value));
+    os.write(buffer, result.ptr - buffer);
+}
+
+void writeString(std::ostream& os, const std::string& text) {
+    os << '"';
+    for (char c : text) {
+        if (c == '"' || c == '\\') {
+            os << '\\' << c;
+        } else if (static_cast<unsigned char>(c) < 0x20) {
+            os << ' ';
+        } else {
+            os << c;
+        }
+    }
+    os << '"';
+}
+
+char assignment(FoldType foldType) {
+    switch (foldType) {
+        case FoldType::MOUNTAIN:
+            return 'M';
+        case FoldType::VALLEY:
+            return 'V';
+        default:
+            return 'F';
+    }
+}
+
+}  // namespace
+
+FoldWriter::FoldWriter(const FoldFileInfo& info, double weldTolerance) : info(info), weldTolerance(weldTolerance) {}
+
+void FoldWriter::write(std::ostream& os, const std::vector<SkeletonConstruction::Point>& polygon,
+                       const std::vector<Crease>& creases) const {
+    writeJson(os, polygon, creases.size(), [&creases](size_t i, double* coordinates) -> std::optional<FoldType> {
+        const Crease& crease = creases[i];
+        if (crease.origin == Origin::POLYGON) {
+            return std::nullopt;
+        }
+        coordinates[0] = CGAL::to_double(crease.edge.first.x());
+        coordinates[1] = CGAL::to_double(crease.edge.first.y());
+        coordinates[2] = CGAL::to_double(crease.edge.second.x());
+        coordinates[3] = CGAL::to_double(crease.edge.second.y());
+        return crease.foldType;
+    });
+}
+
+void FoldWriter::write(std::ostream& os, const std::vector<SkeletonConstruction::Point>& polygon,
+                       std::span<const double> segments, std::span<const std::int8_t> foldTypes) const {
+    if (segments.size() != 4 * foldTypes.size()) {
+        throw std::invalid_argument("Expected four coordinates per fold type");
+    }
+    writeJson(os, polygon, foldTypes.size(), [&](size_t i, double* coordinates) -> std::optional<FoldType> {
+        std::copy(segments.begin() + 4 * i, segments.begin() + 4 * i + 4, coordinates);
+        return static_cast<FoldType>(foldTypes[i]);
+    });
+}
+
+void FoldWriter::write(std::ostream& os, const std::vector<SkeletonConstruction::Point>& polygon,
+                       const CreasePattern& pattern) const {
+    writeJson(os, polygon, pattern.creaseCount(), [&pattern](size_t i, double* coordinates) -> std::optional<FoldType> {
+        if (pattern.origins[i] == Origin::POLYGON) {
+            return std::nullopt;
+        }
+        for (int end = 0; end < 2; end++) {
+            int vertex = pattern.edgeVertices[2 * i + end];
+            coordinates[2 * end] = pattern.vertexCoordinates[2 * vertex];
+            coordinates[2 * end + 1] = pattern.vertexCoordinates[2 * vertex + 1];
+        }
+        return pattern.foldTypes[i];
+    });
+}
+
+void FoldWriter::writeFile(const std::string& path, const std::vector<SkeletonConstruction::Point>& polygon,
+                           const std::vector<Crease>& creases) const {
+    std::ofstream file(path);
+    if (!file) {
+        throw std::runtime_error("Cannot open " + path);
+    }
+    write(file, polygon, creases);
+    if (!file) {
+        throw std::runtime_error("Cannot write " + path);
+    }
+}
+
+template <class CreaseSource>
+void FoldWriter::writeJson(std::ostream& os, const std::vector<SkeletonConstruction::Point>& polygon,
+                           size_t creaseCount, CreaseSource&& crease) const {
+    os << "{\"file_version\": 1, \"file_creator\": ";
+    writeString(os, info.creator);
+    if (!info.author.empty()) {
+        os << ", \"file_author\": ";
+        writeString(os, info.author);
+    }
+    if (!info.classes.empty()) {
+        os << ", \"file_classes\": [";
+        for (size_t i = 0; i < info.classes.size(); i++) {
+            os << (i == 0 ? "" : ", ");
+            writeString(os, info.classes[i]);
+        }
+        os << "]";
+    }
+
+    // Polygon vertices first, so the boundary and the face are 0 .. n - 1 unless polygon vertices weld
+    CreasePatternBuilder builder(weldTolerance);
+    std::vector<int> polygonVertices;
+    polygonVertices.reserve(polygon.size());
+    for (const SkeletonConstruction::Point& p : polygon) {
+        polygonVertices.push_back(builder.addVertex(p));
+    }
+    for (size_t i = 0; i < creaseCount; i++) {
+        double coordinates[4];
+        std::optional<FoldType> foldType = crease(i, coordinates);
+        if (foldType) {
+            int start = builder.addVertex(coordinates[0], coordinates[1]);
+            int end = builder.addVertex(coordinates[2], coordinates[3]);
+            builder.addCrease(start, end, *foldType, Origin::SKELETON);  // FOLD files do not store origins
+        }
+    }
+    CreasePattern pattern = builder.build();
+
+    os << ", \"vertices_coords\": [";
+    for (size_t v = 0; v < pattern.vertexCount(); v++) {
+        os << (v == 0 ? "[" : ", [");
+        writeNumber(os, pattern.vertexCoordinates[2 * v]);
+        os << ", ";
+        writeNumber(os, pattern.vertexCoordinates[2 * v + 1]);
+        os << "]";
+    }
+    os << "]";
+
+    os << ", \"faces_vertices\": [[";
+    for (size_t i = 0; i < polygonVertices.size(); i++) {
+        os << (i == 0 ? "" : ", ") << polygonVertices[i];
+    }
+    os << "]]";
+
+    os << ", \"edges_vertices\": [";
+    size_t n = polygonVertices.size();
+    for (size_t i = 0; i < n; i++) {
+        os << (i == 0 ? "[" : ", [") << polygonVertices[i] << ", " << polygonVertices[(i + 1) % n] << "]";
+    }
+    for (size_t i = 0; i < pattern.creaseCount(); i++) {
+        os << (n == 0 && i == 0 ? "[" : ", [") << pattern.edgeVertices[2 * i] << ", " << pattern.edgeVertices[2 * i + 1]
+           << "]";
+    }
+    os << "]";
+
+    os << ", \"edges_assignment\": [";
+    for (size_t i = 0; i < n; i++) {
+        os << (i == 0 ? "\"B\"" : ", \"B\"");
+    }
+    for (size_t i = 0; i < pattern.creaseCount(); i++) {
+        os << (n == 0 && i == 0 ? "\"" : ", \"") << assignment(pattern.foldTypes[i]) << "\"";
+    }
+    os << "]}\n";
+}
+
+}  // namespace OneCut
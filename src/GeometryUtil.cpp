@@ -1,12 +1,16 @@
 #include "OneCut/utils/GeometryUtil.h"
 
+#include <cmath>
+
 namespace OneCut {
 
-Vector GeometryUtil::rotate90(const Vector& v) {
+template <class Kernel>
+typename BasicGeometryUtil<Kernel>::Vector BasicGeometryUtil<Kernel>::rotate90(const Vector& v) {
     return Vector(-v.y(), v.x());
 }
 
-Vector GeometryUtil::normalize(const Vector& v) {
+template <class Kernel>
+typename BasicGeometryUtil<Kernel>::Vector BasicGeometryUtil<Kernel>::normalize(const Vector& v) {
     auto sqLength = v.squared_length();
     if (sqLength == 0) {
         return v;  // Return the original vector if it's zero-length
@@ -15,11 +19,13 @@ Vector GeometryUtil::normalize(const Vector& v) {
     return v / d;
 }
 
-K::FT GeometryUtil::cross(const Vector& a, const Vector& b) {
+template <class Kernel>
+typename BasicGeometryUtil<Kernel>::FT BasicGeometryUtil<Kernel>::cross(const Vector& a, const Vector& b) {
     return a.x() * b.y() - a.y() * b.x();
 }
 
-K::FT GeometryUtil::scalarProjection(const Vector& a, const Vector& b) {
+template <class Kernel>
+typename BasicGeometryUtil<Kernel>::FT BasicGeometryUtil<Kernel>::scalarProjection(const Vector& a, const Vector& b) {
     auto dot_product = CGAL::scalar_product(a, b);
     auto axis_squared_length = b.squared_length();
 
@@ -30,4 +36,7 @@ K::FT GeometryUtil::scalarProjection(const Vector& a, const Vector& b) {
     return CGAL::to_double(dot_product) / std::sqrt(CGAL::to_double(axis_squared_length));
 }
 
+template class BasicGeometryUtil<ExactKernel>;
+template class BasicGeometryUtil<FastKernel>;
+
 }  // namespace OneCut
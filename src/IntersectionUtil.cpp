@@ -1,13 +1,25 @@
 #include "OneCut/utils/IntersectionUtil.h"
 
+#include <cmath>
+
 namespace OneCut {
 
-IntersectionResult IntersectionUtil::intersectRaySegment(const Point& origin, const Vector& direction,
-                                                         const Point& segmentStart, const Point& segmentEnd) {
-    Vector segmentVector = segmentEnd - segmentStart;
-    double directionCrossSegment = CGAL::to_double(GeometryUtil::cross(direction, segmentVector));
+template <class Kernel>
+IntersectionResult BasicIntersectionUtil<Kernel>::intersectRaySegment(const Point& origin, const Vector& direction,
+                                                                      const Point& segmentStart,
+                                                                      const Point& segmentEnd) {
+    return intersectRayEdge(origin, direction, segmentStart, segmentEnd - segmentStart);
+}
+
+template <class Kernel>
+IntersectionResult BasicIntersectionUtil<Kernel>::intersectRayEdge(const Point& origin, const Vector& direction,
+                                                                   const Point& segmentStart,
+                                                                   const Vector& segmentVector) {
+    using Geometry = BasicGeometryUtil<Kernel>;
+
+    double directionCrossSegment = CGAL::to_double(Geometry::cross(direction, segmentVector));
     Vector originToSegmentStart = Vector(segmentStart.x() - origin.x(), segmentStart.y() - origin.y());
-    double originToStartCrossDirection = CGAL::to_double(GeometryUtil::cross(originToSegmentStart, direction));
+    double originToStartCrossDirection = CGAL::to_double(Geometry::cross(originToSegmentStart, direction));
 
     if (std::fabs(directionCrossSegment) < 1e-13) {  // Check for near-parallel lines
         return {false, 0, 0};
@@ -15,10 +27,13 @@ IntersectionResult IntersectionUtil::intersectRaySegment(const Point& origin, co
 
     // Calculate ray intersection parameter (t) and segment parameter (u)
     double rayParameter =
-        CGAL::to_double(GeometryUtil::cross(originToSegmentStart, segmentVector) / directionCrossSegment);
+        CGAL::to_double(Geometry::cross(originToSegmentStart, segmentVector) / directionCrossSegment);
     double segmentParameter = originToStartCrossDirection / directionCrossSegment;
 
     return {true, rayParameter, segmentParameter};
 }
 
+template class BasicIntersectionUtil<ExactKernel>;
+template class BasicIntersectionUtil<FastKernel>;
+
 }  // namespace OneCut
@@ -2,130 +2,745 @@
 
 #include <CGAL/number_utils.h>
 
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <exception>
 #include <iostream>
+#include <limits>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+
+#include "OneCut/CompactSkeleton.h"
+#include "OneCut/Tracer.h"
+#include "OneCut/utils/WeldGrid.h"
 
 namespace OneCut {
 
-PerpendicularFinder::PerpendicularFinder(const IStraightSkeleton& skeleton) : skeleton(skeleton) {}
+namespace {
 
-std::vector<PerpChain> PerpendicularFinder::findPerpendiculars() {
-    std::vector<PerpChain> perpendicularChains;
+// Seeds handed to a worker at a time; small enough to balance, large enough to keep the counter cold
+constexpr size_t SEED_CHUNK = 16;
 
-    int faceCount = skeleton.faceCount();
-    for (int faceIdx = 0; faceIdx < faceCount; faceIdx++) {
-        const ISkeletonFace& face = skeleton.face(faceIdx);
+const char* terminationName(ChainTermination termination) {
+    switch (termination) {
+        case ChainTermination::BOUNDARY: return "boundary";
+        case ChainTermination::INVALID_HIT: return "invalid hit";
+        case ChainTermination::EDGE_LOOKUP_FAILED: return "edge lookup failed";
+        case ChainTermination::CYCLE: return "cycle";
+        case ChainTermination::CHAIN_BUDGET: return "chain budget";
+        case ChainTermination::JOB_BUDGET: return "job budget";
+        case ChainTermination::MERGED: return "merged";
+    }
+    return "unknown";
+}
 
-        // Vertex 0 and 1 form the cut edge
-        for (int vertexIdx = 2; vertexIdx < face.vertexCount(); vertexIdx++) {
-            if (face.adjacentFaceIndex(vertexIdx) == -1 || face.adjacentFaceIndex(vertexIdx - 1) == -1) {
-                continue;  // Skip if no adjacent faces
+int resolveThreadCount(int threadCount) {
+    if (threadCount > 0) {
+        return threadCount;
+    }
+    return std::max(1u, std::thread::hardware_concurrency());
+}
+
+// Threads tracing the chains of one call. A job budget is charged in seed order, which takes a
+// single thread; otherwise the chains it cuts short would depend on the thread scheduling.
+int tracingThreadCount(int threadCount, size_t jobBudget) {
+    return jobBudget > 0 ? 1 : resolveThreadCount(threadCount);
+}
+
+struct PairHash {
+    size_t operator()(const std::pair<long long, long long>& key) const {
+        size_t h1 = std::hash<long long>()(key.first);
+        size_t h2 = std::hash<long long>()(key.second);
+        return h1 ^ (h2 << 1);
+    }
+};
+
+// Collects chain segments into a BasicPerpGraph, merging equal points and segments, and
+// remembers through which edge point each face was entered and how far the path behind it was traced.
+template <class Kernel>
+class GraphAssembler {
+   public:
+    using KernelPoint = typename Kernel::Point_2;
+
+    /// Coverage of a path that ended on its own, so it was traced in full
+    static constexpr int COMPLETE_PATH = std::numeric_limits<int>::max();
+
+    GraphAssembler(BasicPerpGraph<Kernel>& graph, double snap, PipelineStats& stats)
+        : graph(graph), weld(snap), entryPoints(snap), stats(stats) {}
+
+    // Index of the point in the graph; points within the snap distance of a graph vertex share its index
+    int vertexIndex(const KernelPoint& point) {
+        auto [index, inserted] = weld.insert(CGAL::to_double(point.x()), CGAL::to_double(point.y()));
+        if (inserted) {
+            graph.vertices.push_back(point);
+        }
+        return index;
+    }
+
+    // Adds the segment unless it, or its reverse, is already in the graph
+    void addSegment(const BasicPerpSegment<Kernel>& segment) {
+        int start = vertexIndex(segment.start);
+        int end = vertexIndex(segment.end);
+        if (start == end) {
+            return;
+        }
+        if (!segments.emplace(std::min(start, end), std::max(start, end)).second) {
+            stats.duplicateSegments++;
+            return;
+        }
+        graph.segments.push_back({start, end, segment.faceIndex});
+    }
+
+    // Starts the entries of the next chain
+    void beginChain() { chainEntries.clear(); }
+
+    // Marks the face as entered by the current chain through the given edge at the given point, after
+    // step iterations and with remaining iterations left. False if the chain can stop there: it came
+    // back to a point it entered itself, or an earlier chain traced at least remaining iterations on.
+    bool enter(int faceIndex, int edgeIndex, const KernelPoint& point, int step, int remaining) {
+        long long edgeKey = (static_cast<long long>(faceIndex) << 32) | static_cast<unsigned int>(edgeIndex);
+        // Entry points are welded apart from the graph vertices, which only hold segment end points
+        int entryPoint = entryPoints.insert(CGAL::to_double(point.x()), CGAL::to_double(point.y())).first;
+        std::pair<long long, long long> key(edgeKey, entryPoint);
+        auto [entered, inserted] = enteredEdgePoints.try_emplace(key, PENDING_PATH);
+        int previousCoverage = inserted ? 0 : entered->second;
+        if (!inserted && (previousCoverage == PENDING_PATH || previousCoverage >= remaining)) {
+            stats.revisitedEdgePoints++;
+            mergeStep = step;
+            mergeCoverage = previousCoverage == PENDING_PATH ? COMPLETE_PATH : previousCoverage;
+            return false;
+        }
+        entered->second = PENDING_PATH;
+        chainEntries.push_back({key, step, previousCoverage});
+        return true;
+    }
+
+    // Records how far the paths behind the entries of the current chain were traced; steps is the
+    // number of segments the chain added, termination why it stopped
+    void endChain(ChainTermination termination, int steps) {
+        for (const ChainEntryPoint& entry : chainEntries) {
+            long long coverage = COMPLETE_PATH;  // The chain ended on its own
+            if (termination == ChainTermination::CHAIN_BUDGET || termination == ChainTermination::JOB_BUDGET) {
+                coverage = steps - entry.step;
+            } else if (termination == ChainTermination::MERGED && mergeCoverage != COMPLETE_PATH) {
+                coverage = std::min<long long>(mergeStep - entry.step + static_cast<long long>(mergeCoverage),
+                                               COMPLETE_PATH - 1);
             }
+            enteredEdgePoints[entry.key] = std::max(static_cast<int>(coverage), entry.previousCoverage);
+        }
+        chainEntries.clear();
+    }
+
+    // Drops the vertices of segments that collapsed to a point and renumbers the segments, so every
+    // graph vertex is the end point of a segment
+    void finish() {
+        std::vector<int> newIndex(graph.vertices.size(), -1);
+        for (const PerpGraphSegment& segment : graph.segments) {
+            newIndex[segment.start] = newIndex[segment.end] = 0;
+        }
+        size_t kept = 0;
+        for (size_t v = 0; v < graph.vertices.size(); v++) {
+            if (newIndex[v] == 0) {
+                newIndex[v] = static_cast<int>(kept);
+                graph.vertices[kept++] = graph.vertices[v];
+            }
+        }
+        if (kept == graph.vertices.size()) {
+            return;
+        }
+        graph.vertices.resize(kept);
+        for (PerpGraphSegment& segment : graph.segments) {
+            segment.start = newIndex[segment.start];
+            segment.end = newIndex[segment.end];
+        }
+    }
 
-            PerpChain chain;
-            Point currentVertex = face.vertex(vertexIdx);
+   private:
+    // Coverage of the points entered by the chain being traced, known once it stopped
+    static constexpr int PENDING_PATH = -1;
 
-            // Skip vertices outside the paper bounds
-            if (currentVertex.x() < 0 || currentVertex.y() < 0 || currentVertex.x() > PAPER_BORDER_X ||
-                currentVertex.y() > PAPER_BORDER_Y) {
-                continue;
+    struct ChainEntryPoint {
+        std::pair<long long, long long> key;  // (face << 32 | edge, entry point)
+        int step;                             // Segments the chain had added when it entered the point
+        int previousCoverage;                 // Coverage of an earlier chain through the point, 0 if none
+    };
+
+    BasicPerpGraph<Kernel>& graph;
+    WeldGrid weld;         // Graph vertices
+    WeldGrid entryPoints;  // Points faces were entered through
+    PipelineStats& stats;
+    std::unordered_set<std::pair<long long, long long>, PairHash> segments;  // (min, max) vertex index
+    // (face << 32 | edge, entry point) -> iterations traced on from that point, COMPLETE_PATH or PENDING_PATH
+    std::unordered_map<std::pair<long long, long long>, int, PairHash> enteredEdgePoints;
+    std::vector<ChainEntryPoint> chainEntries;  // Points entered by the current chain
+    int mergeStep = 0;                          // Segments of the current chain when enter() stopped it
+    int mergeCoverage = 0;                      // Coverage of the point it stopped at
+};
+
+// Face, entry edge and snapped entry point of one tracing step, the state cycle detection compares
+struct ChainEntry {
+    int faceIndex;
+    int edgeIndex;
+    long long x;
+    long long y;
+
+    bool operator==(const ChainEntry& other) const = default;
+};
+
+template <class Point2>
+ChainEntry chainEntry(int faceIndex, int edgeIndex, const Point2& point, double snap) {
+    return {faceIndex, edgeIndex, std::llround(CGAL::to_double(point.x()) / snap),
+            std::llround(CGAL::to_double(point.y()) / snap)};
+}
+
+// End of the part of the segment from start to end that lies on the paper; start must lie on it
+template <class Kernel>
+typename Kernel::Point_2 clipToPaper(const typename Kernel::Point_2& start, const typename Kernel::Point_2& end,
+                                     const Paper& paper) {
+    using FT = typename Kernel::FT;
+    FT dx = end.x() - start.x();
+    FT dy = end.y() - start.y();
+    FT t(1);
+    auto limit = [&t](const FT& from, const FT& delta, double border) {
+        FT borderT = (FT(border) - from) / delta;
+        if (borderT < t) {
+            t = borderT;
+        }
+    };
+    if (end.x() < paper.xMin) {
+        limit(start.x(), dx, paper.xMin);
+    } else if (end.x() > paper.xMax) {
+        limit(start.x(), dx, paper.xMax);
+    }
+    if (end.y() < paper.yMin) {
+        limit(start.y(), dy, paper.yMin);
+    } else if (end.y() > paper.yMax) {
+        limit(start.y(), dy, paper.yMax);
+    }
+    // Rounding must not push the end point off the paper
+    auto clamp = [](FT value, double low, double high) {
+        return value < low ? FT(low) : value > high ? FT(high) : value;
+    };
+    return typename Kernel::Point_2(clamp(start.x() + t * dx, paper.xMin, paper.xMax),
+                                    clamp(start.y() + t * dy, paper.yMin, paper.yMax));
+}
+
+}  // namespace
+
+template <class Kernel>
+struct BasicPerpendicularFinder<Kernel>::JobBudget {
+    size_t limit;                   // 0 for no limit
+    std::atomic<size_t> spent{0};
+
+    explicit JobBudget(size_t limit) : limit(limit) {}
+
+    // Takes one iteration; false once the budget is used up
+    bool take() { return limit == 0 || spent.fetch_add(1, std::memory_order_relaxed) < limit; }
+};
+
+template <class Kernel>
+BasicPerpendicularFinder<Kernel>::BasicPerpendicularFinder(const IStraightSkeleton& skeleton) {
+    size_t faceCount = skeleton.faceCount();
+    faces.resize(faceCount);
+
+    // Faces stored in the kernel are viewed in place, all others are converted once
+    std::vector<std::pair<size_t, size_t>> convertedFaces;  // face index, offset in ownedVertices
+    for (size_t i = 0; i < faceCount; i++) {
+        const ISkeletonFace& face = skeleton.face(i);
+        faces[i].adjacentFaces = face.adjacentFaceSpan();
+        faces[i].twinEdges = face.twinEdgeSpan();
+
+        if (const auto* kernelFace = dynamic_cast<const BasicSkeletonFace<Kernel>*>(&face)) {
+            faces[i].vertices = kernelFace->vertexSpan();
+            continue;
+        }
+
+        convertedFaces.emplace_back(i, ownedVertices.size());
+        if (const auto* compactFace = dynamic_cast<const CompactFace*>(&face)) {
+            for (size_t v = 0; v < compactFace->vertexCount(); v++) {
+                ownedVertices.emplace_back(compactFace->x(v), compactFace->y(v));
+            }
+        } else if (const auto* exactFace = dynamic_cast<const SkeletonFace*>(&face)) {
+            for (const Point& vertex : exactFace->vertexSpan()) {
+                ownedVertices.push_back(convertPoint<Kernel>(vertex));
             }
+        } else {
+            for (size_t v = 0; v < face.vertexCount(); v++) {
+                ownedVertices.push_back(convertPoint<Kernel>(face.vertex(v)));
+            }
+        }
+    }
 
-            int currentFaceIdx = faceIdx;
-            int currentEdgeIdx = vertexIdx;
+    std::span<const KernelPoint> allOwnedVertices(ownedVertices);
+    for (const auto& [faceIndex, offset] : convertedFaces) {
+        faces[faceIndex].vertices = allOwnedVertices.subspan(offset, faces[faceIndex].adjacentFaces.size());
+    }
 
-            for (int iteration = 0; iteration < MAX_ITERATIONS; iteration++) {
-                PerpendicularHit perpHit =
-                    computePerpendicularIntersection(currentVertex, skeleton.face(currentFaceIdx), currentEdgeIdx);
+    prepareFaces();
+}
 
-                if (!perpHit.isValid) {
-                    break;
-                }
+template <class Kernel>
+void BasicPerpendicularFinder<Kernel>::prepareFaces() {
+    using Geometry = BasicGeometryUtil<Kernel>;
+
+    size_t edgeCount = 0;
+    for (const PreparedFace& face : faces) {
+        edgeCount += face.vertexCount();
+    }
+    edgeVectors.reserve(edgeCount);
+    perpendicularSides.reserve(edgeCount);
+
+    for (PreparedFace& face : faces) {
+        size_t n = face.vertexCount();
+        if (n < 2) {
+            continue;
+        }
+
+        // Vertex 0 and 1 form the cut edge; rays run perpendicular to it
+        KernelVector perpendicular = Geometry::normalize(Geometry::rotate90(face.vertices[1] - face.vertices[0]));
+        face.perpendiculars[0] = perpendicular;
+        face.perpendiculars[1] = -perpendicular;
+
+        for (size_t e = 0; e < n; e++) {
+            KernelVector edgeVector = face.vertices[(e + 1) % n] - face.vertices[e];
+            // A ray leaving edge e has to point to its left, i.e. into the face
+            bool flip = CGAL::orientation(edgeVector, perpendicular) == CGAL::RIGHT_TURN;
+            edgeVectors.push_back(edgeVector);
+            perpendicularSides.push_back(flip ? 1 : 0);
+        }
+    }
+
+    std::span<const KernelVector> allEdgeVectors(edgeVectors);
+    std::span<const std::uint8_t> allPerpendicularSides(perpendicularSides);
+    size_t offset = 0;
+    for (PreparedFace& face : faces) {
+        if (face.vertexCount() < 2) {
+            continue;
+        }
+        face.edgeVectors = allEdgeVectors.subspan(offset, face.vertexCount());
+        face.perpendicularSide = allPerpendicularSides.subspan(offset, face.vertexCount());
+        offset += face.vertexCount();
+    }
+}
+
+template <class Kernel>
+std::vector<typename BasicPerpendicularFinder<Kernel>::Chain> BasicPerpendicularFinder<Kernel>::findPerpendiculars() {
+    PipelineStats stats;
+    return findPerpendiculars(stats);
+}
+
+template <class Kernel>
+std::vector<typename BasicPerpendicularFinder<Kernel>::Chain> BasicPerpendicularFinder<Kernel>::findPerpendiculars(
+    PipelineStats& stats) {
+    StageTimer timer;
+    TraceSpan span("perpendiculars", "perpendiculars");
+    std::vector<Seed> seeds = collectSeeds();
+    span.arg("seeds", static_cast<std::int64_t>(seeds.size()));
+    JobBudget budget(jobBudget);
+
+    // One slot per seed, so the merged result does not depend on the thread count
+    std::vector<Chain> chainsBySeed(seeds.size());
+    std::vector<ChainTermination> terminationsBySeed(seeds.size());
+    forEachSeed(seeds.size(), stats, [&](size_t i, PipelineStats& workerStats) {
+        chainsBySeed[i] = traceChain(seeds[i], budget, workerStats, terminationsBySeed[i]);
+    });
 
-                chain.push_back({currentVertex, perpHit.intersection, currentFaceIdx});
+    std::vector<Chain> perpendicularChains;
+    terminations.clear();
+    for (size_t i = 0; i < seeds.size(); i++) {
+        if (!chainsBySeed[i].empty()) {
+            perpendicularChains.push_back(std::move(chainsBySeed[i]));
+            terminations.push_back(terminationsBySeed[i]);
+        }
+    }
+
+    stats.chainCount += perpendicularChains.size();
+    stats.perpendicularsMs += timer.elapsedMs();
+    return perpendicularChains;
+}
 
-                int adjacentFaceIdx = skeleton.face(currentFaceIdx).adjacentFaceIndex(perpHit.edgeIndex);
-                if (adjacentFaceIdx == -1) {
+template <class Kernel>
+typename BasicPerpendicularFinder<Kernel>::Graph BasicPerpendicularFinder<Kernel>::findPerpendicularGraph() {
+    PipelineStats stats;
+    return findPerpendicularGraph(stats);
+}
+
+template <class Kernel>
+typename BasicPerpendicularFinder<Kernel>::Graph BasicPerpendicularFinder<Kernel>::findPerpendicularGraph(
+    PipelineStats& stats) {
+    StageTimer timer;
+    TraceSpan span("perpendicular graph", "perpendiculars");
+    std::vector<Seed> seeds = collectSeeds();
+    span.arg("seeds", static_cast<std::int64_t>(seeds.size()));
+    JobBudget budget(jobBudget);
+    Graph graph;
+    GraphAssembler<Kernel> assembler(graph, VERTEX_SNAP, stats);
+
+    // Iterations a chain may still take after adding steps segments
+    auto remainingAfter = [this](int steps) {
+        return chainBudget > 0 ? chainBudget - steps : GraphAssembler<Kernel>::COMPLETE_PATH;
+    };
+    // Adds the step-th segment of a chain; false once the chain enters an edge point from which an earlier
+    // chain traced at least as far as this one still may, since the rest of its path is in the graph already
+    auto addSegment = [&](const BasicPerpSegment<Kernel>& segment, int nextFace, int nextEdge, int step) {
+        assembler.addSegment(segment);
+        return nextFace < 0 || assembler.enter(nextFace, nextEdge, segment.end, step, remainingAfter(step));
+    };
+    auto enterSeed = [&](const Seed& seed) {
+        assembler.beginChain();
+        return assembler.enter(seed.faceIndex, seed.vertexIndex, faces[seed.faceIndex].vertices[seed.vertexIndex],
+                               0, remainingAfter(0));
+    };
+
+    if (tracingThreadCount(threadCount, jobBudget) <= 1) {
+        for (const Seed& seed : seeds) {
+            if (!enterSeed(seed)) {
+                continue;
+            }
+            size_t segmentCount = graph.segments.size();
+            int steps = 0;
+            auto visit = [&](const BasicPerpSegment<Kernel>& segment, int nextFace, int nextEdge) {
+                return addSegment(segment, nextFace, nextEdge, ++steps);
+            };
+            ChainTermination termination = traceSegments(seed, budget, stats, visit);
+            assembler.endChain(termination, steps);
+            stats.chainCount += graph.segments.size() > segmentCount ? 1 : 0;
+        }
+    } else {
+        // Chains are traced in full on all threads and then merged in seed order, stopping at the
+        // same edge points as the serial loop above, so the graph does not depend on the thread count
+        struct Step {
+            BasicPerpSegment<Kernel> segment;
+            int nextFace;
+            int nextEdge;
+        };
+        std::vector<std::vector<Step>> stepsBySeed(seeds.size());
+        std::vector<ChainTermination> terminationsBySeed(seeds.size());
+        forEachSeed(seeds.size(), stats, [&](size_t i, PipelineStats& workerStats) {
+            terminationsBySeed[i] = traceSegments(seeds[i], budget, workerStats,
+                                                  [&](const BasicPerpSegment<Kernel>& segment, int nextFace,
+                                                      int nextEdge) {
+                stepsBySeed[i].push_back({segment, nextFace, nextEdge});
+                return true;
+            });
+        });
+
+        for (size_t i = 0; i < seeds.size(); i++) {
+            if (!enterSeed(seeds[i])) {
+                continue;
+            }
+            size_t segmentCount = graph.segments.size();
+            int steps = 0;
+            ChainTermination termination = terminationsBySeed[i];
+            for (const Step& step : stepsBySeed[i]) {
+                if (!addSegment(step.segment, step.nextFace, step.nextEdge, ++steps)) {
+                    termination = ChainTermination::MERGED;
                     break;
                 }
+            }
+            assembler.endChain(termination, steps);
+            stats.chainCount += graph.segments.size() > segmentCount ? 1 : 0;
+        }
+    }
 
-                Point adjacentEdgeStartVertex =
-                    skeleton.face(currentFaceIdx)
-                        .vertex((perpHit.edgeIndex + 1) % skeleton.face(currentFaceIdx).vertexCount());
+    assembler.finish();
+    stats.perpendicularsMs += timer.elapsedMs();
+    return graph;
+}
 
-                int adjacentEdgeIdx = findEdgeIndex(skeleton.face(adjacentFaceIdx), adjacentEdgeStartVertex);
-                if (adjacentEdgeIdx < 0) {
-                    break;
+template <class Kernel>
+template <class Trace>
+void BasicPerpendicularFinder<Kernel>::forEachSeed(size_t seedCount, PipelineStats& stats, Trace&& trace) const {
+    int workerCount = std::min<size_t>(tracingThreadCount(threadCount, jobBudget),
+                                       (seedCount + SEED_CHUNK - 1) / SEED_CHUNK);
+    if (workerCount <= 1) {
+        for (size_t i = 0; i < seedCount; i++) {
+            trace(i, stats);
+        }
+        return;
+    }
+
+    std::atomic<size_t> nextSeed{0};
+    std::vector<PipelineStats> workerStats(workerCount);
+    std::vector<std::exception_ptr> workerErrors(workerCount);
+
+    // Idle workers grab the next chunk of seeds, so long chains do not stall a fixed partition
+    auto work = [&](int worker) {
+        try {
+            for (size_t begin = nextSeed.fetch_add(SEED_CHUNK); begin < seedCount;
+                 begin = nextSeed.fetch_add(SEED_CHUNK)) {
+                size_t end = std::min(begin + SEED_CHUNK, seedCount);
+                for (size_t i = begin; i < end; i++) {
+                    trace(i, workerStats[worker]);
                 }
+            }
+        } catch (...) {
+            workerErrors[worker] = std::current_exception();
+        }
+    };
+
+    std::vector<std::thread> workers;
+    workers.reserve(workerCount - 1);
+    for (int worker = 1; worker < workerCount; worker++) {
+        workers.emplace_back(work, worker);
+    }
+    work(0);
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+
+    for (int worker = 0; worker < workerCount; worker++) {
+        if (workerErrors[worker]) {
+            std::rethrow_exception(workerErrors[worker]);
+        }
+        stats.chainIterations += workerStats[worker].chainIterations;
+        stats.invalidHits += workerStats[worker].invalidHits;
+        stats.edgeLookupFailures += workerStats[worker].edgeLookupFailures;
+        stats.boundaryStops += workerStats[worker].boundaryStops;
+        stats.cycleStops += workerStats[worker].cycleStops;
+        stats.chainBudgetStops += workerStats[worker].chainBudgetStops;
+        stats.jobBudgetStops += workerStats[worker].jobBudgetStops;
+    }
+}
+
+template <class Kernel>
+void BasicPerpendicularFinder<Kernel>::setThreadCount(int threadCount) {
+    this->threadCount = threadCount;
+}
+
+template <class Kernel>
+int BasicPerpendicularFinder<Kernel>::getThreadCount() const {
+    return threadCount;
+}
+
+template <class Kernel>
+void BasicPerpendicularFinder<Kernel>::setChainBudget(int chainBudget) {
+    this->chainBudget = chainBudget;
+}
+
+template <class Kernel>
+int BasicPerpendicularFinder<Kernel>::getChainBudget() const {
+    return chainBudget;
+}
+
+template <class Kernel>
+void BasicPerpendicularFinder<Kernel>::setJobBudget(size_t jobBudget) {
+    this->jobBudget = jobBudget;
+}
+
+template <class Kernel>
+size_t BasicPerpendicularFinder<Kernel>::getJobBudget() const {
+    return jobBudget;
+}
+
+template <class Kernel>
+void BasicPerpendicularFinder<Kernel>::setPaper(const Paper& paper) {
+    this->paper = paper;
+}
+
+template <class Kernel>
+const Paper& BasicPerpendicularFinder<Kernel>::getPaper() const {
+    return paper;
+}
 
-                currentVertex = perpHit.intersection;
-                currentFaceIdx = adjacentFaceIdx;
-                currentEdgeIdx = adjacentEdgeIdx;
+template <class Kernel>
+const std::vector<ChainTermination>& BasicPerpendicularFinder<Kernel>::getTerminations() const {
+    return terminations;
+}
+
+template <class Kernel>
+std::vector<typename BasicPerpendicularFinder<Kernel>::Seed> BasicPerpendicularFinder<Kernel>::collectSeeds() const {
+    std::vector<Seed> seeds;
+
+    int faceCount = faces.size();
+    for (int faceIdx = 0; faceIdx < faceCount; faceIdx++) {
+        const PreparedFace& face = faces[faceIdx];
+
+        // Vertex 0 and 1 form the cut edge
+        for (int vertexIdx = 2; vertexIdx < face.vertexCount(); vertexIdx++) {
+            if (face.adjacentFaces[vertexIdx] == -1 || face.adjacentFaces[vertexIdx - 1] == -1) {
+                continue;  // Skip if no adjacent faces
             }
 
-            if (!chain.empty()) {
-                perpendicularChains.push_back(chain);
+            // Skip vertices outside the paper
+            const KernelPoint& vertex = face.vertices[vertexIdx];
+            if (!paper.contains(vertex.x(), vertex.y())) {
+                continue;
             }
+
+            seeds.push_back({faceIdx, vertexIdx});
         }
     }
-    return perpendicularChains;
+    return seeds;
 }
 
-PerpendicularHit PerpendicularFinder::computePerpendicularIntersection(const Point& vertex, const ISkeletonFace& face,
-                                                                       int edgeIndex) {
-    if (face.vertexCount() < 2) {
-        return {false, Point(0, 0), -1};
+template <class Kernel>
+template <class SegmentVisitor>
+ChainTermination BasicPerpendicularFinder<Kernel>::traceSegments(const Seed& seed, JobBudget& budget,
+                                                                 PipelineStats& stats, SegmentVisitor&& visit) const {
+    TraceSpan span("chain", "perpendiculars");
+    size_t iterationsBefore = stats.chainIterations;
+    ChainTermination termination = walkSegments(seed, budget, stats, visit);
+    if (span.enabled()) {
+        span.arg("seedFace", seed.faceIndex);
+        span.arg("seedVertex", seed.vertexIndex);
+        span.arg("iterations", static_cast<std::int64_t>(stats.chainIterations - iterationsBefore));
+        span.arg("termination", terminationName(termination));
     }
+    return termination;
+}
+
+template <class Kernel>
+template <class SegmentVisitor>
+ChainTermination BasicPerpendicularFinder<Kernel>::walkSegments(const Seed& seed, JobBudget& budget,
+                                                                PipelineStats& stats, SegmentVisitor&& visit) const {
+    KernelPoint currentVertex = faces[seed.faceIndex].vertices[seed.vertexIndex];
+    int currentFaceIdx = seed.faceIndex;
+    int currentEdgeIdx = seed.vertexIndex;
+
+    // Brent: the saved entry moves to the current one after 1, 2, 4, ... steps; a loop is
+    // found once the saved entry lies on it and the chain comes back to it
+    ChainEntry savedEntry = chainEntry(seed.faceIndex, seed.vertexIndex, currentVertex, VERTEX_SNAP);
+    int stepsSinceSaved = 0;
+    int saveInterval = 1;
+
+    for (int iteration = 0;; iteration++) {
+        if (chainBudget > 0 && iteration >= chainBudget) {
+            stats.chainBudgetStops++;
+            return ChainTermination::CHAIN_BUDGET;
+        }
+        if (!budget.take()) {
+            stats.jobBudgetStops++;
+            return ChainTermination::JOB_BUDGET;
+        }
+
+        stats.chainIterations++;
+        BasicPerpendicularHit<Kernel> perpHit =
+            computePerpendicularIntersection(currentVertex, faces[currentFaceIdx], currentEdgeIdx);
+
+        if (!perpHit.isValid) {
+            stats.invalidHits++;
+            return ChainTermination::INVALID_HIT;
+        }
+
+        // A chain leaving the paper ends at its border
+        if (!paper.contains(perpHit.intersection.x(), perpHit.intersection.y())) {
+            KernelPoint border = clipToPaper<Kernel>(currentVertex, perpHit.intersection, paper);
+            visit(BasicPerpSegment<Kernel>{currentVertex, border, currentFaceIdx}, -1, -1);
+            stats.boundaryStops++;
+            return ChainTermination::BOUNDARY;
+        }
+
+        const PreparedFace& currentFace = faces[currentFaceIdx];
+        int adjacentFaceIdx = currentFace.adjacentFaces[perpHit.edgeIndex];
+        int adjacentEdgeIdx = -1;
+        if (adjacentFaceIdx != -1) {
+            adjacentEdgeIdx = crossEdge(currentFace, perpHit.edgeIndex);
+            if (adjacentEdgeIdx < 0) {
+                stats.edgeLookupFailures++;
+            }
+        }
 
-    Vector cutEdgeVector = face.vertex(1) - face.vertex(0);
-    Vector perpendicularDir = GeometryUtil::rotate90(cutEdgeVector);
-    perpendicularDir = GeometryUtil::normalize(perpendicularDir);
+        bool proceed = visit(BasicPerpSegment<Kernel>{currentVertex, perpHit.intersection, currentFaceIdx},
+                             adjacentEdgeIdx < 0 ? -1 : adjacentFaceIdx, adjacentEdgeIdx);
+        if (adjacentFaceIdx == -1) {
+            stats.boundaryStops++;
+            return ChainTermination::BOUNDARY;
+        }
+        if (adjacentEdgeIdx < 0) {
+            return ChainTermination::EDGE_LOOKUP_FAILED;
+        }
+        if (!proceed) {
+            return ChainTermination::MERGED;
+        }
+
+        currentVertex = perpHit.intersection;
+        currentFaceIdx = adjacentFaceIdx;
+        currentEdgeIdx = adjacentEdgeIdx;
+
+        ChainEntry entry = chainEntry(currentFaceIdx, currentEdgeIdx, currentVertex, VERTEX_SNAP);
+        if (entry == savedEntry) {
+            stats.cycleStops++;
+            return ChainTermination::CYCLE;
+        }
+        if (++stepsSinceSaved == saveInterval) {
+            savedEntry = entry;
+            stepsSinceSaved = 0;
+            saveInterval *= 2;
+        }
+    }
+}
 
-    Point edgeStart = face.vertex(edgeIndex);
-    Point edgeEnd = face.vertex((edgeIndex + 1) % face.vertexCount());
-    Vector edgeVector = edgeEnd - edgeStart;
+template <class Kernel>
+typename BasicPerpendicularFinder<Kernel>::Chain BasicPerpendicularFinder<Kernel>::traceChain(
+    const Seed& seed, JobBudget& budget, PipelineStats& stats, ChainTermination& termination) const {
+    Chain chain;
+    termination = traceSegments(seed, budget, stats, [&chain](const BasicPerpSegment<Kernel>& segment, int, int) {
+        chain.push_back(segment);
+        return true;
+    });
+    return chain;
+}
 
-    CGAL::Orientation orientation = CGAL::orientation(Point(0, 0), Point(edgeVector.x(), edgeVector.y()),
-                                                      Point(perpendicularDir.x(), perpendicularDir.y()));
-    if (orientation == CGAL::RIGHT_TURN) {
-        perpendicularDir = -perpendicularDir;
+template <class Kernel>
+BasicPerpendicularHit<Kernel> BasicPerpendicularFinder<Kernel>::computePerpendicularIntersection(
+    const KernelPoint& vertex, const PreparedFace& face, int edgeIndex) const {
+    if (face.vertexCount() < 2) {
+        return {false, KernelPoint(0, 0), -1};
     }
 
+    const KernelVector& perpendicularDir = face.perpendiculars[face.perpendicularSide[edgeIndex]];
+
     double minRayParam = std::numeric_limits<double>::infinity();
     int closestEdgeIndex = -1;
-    Point closestIntersection;
 
     for (int e = 0; e < face.vertexCount(); e++) {
         if (e == edgeIndex) {
             continue;
         }
 
-        Point segmentStart = face.vertex(e);
-        Point segmentEnd = face.vertex((e + 1) % face.vertexCount());
-
-        auto intersection = IntersectionUtil::intersectRaySegment(vertex, perpendicularDir, segmentStart, segmentEnd);
+        auto intersection = BasicIntersectionUtil<Kernel>::intersectRayEdge(vertex, perpendicularDir, face.vertices[e],
+                                                                            face.edgeVectors[e]);
         if (intersection.valid && intersection.rayParam > 0 && intersection.rayParam < minRayParam &&
             intersection.segmentParam >= 0 && intersection.segmentParam <= 1) {
             minRayParam = intersection.rayParam;
             closestEdgeIndex = e;
-            closestIntersection =
-                Point(vertex.x() + perpendicularDir.x() * minRayParam, vertex.y() + perpendicularDir.y() * minRayParam);
         }
     }
 
     if (closestEdgeIndex < 0) {
-        return {false, Point(0, 0), -1};
+        return {false, KernelPoint(0, 0), -1};
     }
 
+    // Only the closest hit is constructed
+    KernelPoint closestIntersection(vertex.x() + perpendicularDir.x() * minRayParam,
+                                    vertex.y() + perpendicularDir.y() * minRayParam);
     return {true, closestIntersection, closestEdgeIndex};
 }
 
-int PerpendicularFinder::findEdgeIndex(const ISkeletonFace& face, const Point& startPoint) const {
+template <class Kernel>
+int BasicPerpendicularFinder<Kernel>::crossEdge(const PreparedFace& face, int edgeIndex) const {
+    if (!face.twinEdges.empty()) {
+        return face.twinEdges[edgeIndex];
+    }
+
+    const KernelPoint& adjacentEdgeStartVertex = face.vertices[(edgeIndex + 1) % face.vertexCount()];
+    return findEdgeIndex(faces[face.adjacentFaces[edgeIndex]], adjacentEdgeStartVertex);
+}
+
+template <class Kernel>
+int BasicPerpendicularFinder<Kernel>::findEdgeIndex(const PreparedFace& face, const KernelPoint& startPoint) const {
     for (int i = 0; i < face.vertexCount(); i++) {
-        if (face.vertex(i) == startPoint) {
+        if (face.vertices[i] == startPoint) {
             return i;
         }
     }
     return -1;
 }
 
+template class BasicPerpendicularFinder<ExactKernel>;
+template class BasicPerpendicularFinder<FastKernel>;
+
 }  // namespace OneCut
@@ -0,0 +1,185 @@
+#include "OneCut/utils/PolygonGenerator.h"
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <stdexcept>
+
+namespace OneCut {
+
+namespace {
+
+const double PI = 3.14159265358979323846;
+
+SkeletonConstruction::Point polar(double radius, double angle) {
+    return SkeletonConstruction::Point(PolygonGenerator::CENTER + radius * std::cos(angle),
+                                       PolygonGenerator::CENTER + radius * std::sin(angle));
+}
+
+}  // namespace
+
+std::vector<SkeletonConstruction::Point> PolygonGenerator::convex(int n) {
+    n = std::max(n, 3);
+    std::vector<SkeletonConstruction::Point> polygon;
+    polygon.reserve(n);
+    for (int i = 0; i < n; i++) {
+        polygon.push_back(polar(RADIUS, 2 * PI * i / n));
+    }
+    return polygon;
+}
+
+std::vector<SkeletonConstruction::Point> PolygonGenerator::star(int n) {
+    n = std::max(n / 2, 3) * 2;
+    std::vector<SkeletonConstruction::Point> polygon;
+    polygon.reserve(n);
+    for (int i = 0; i < n; i++) {
+        double radius = (i % 2 == 0) ? RADIUS : RADIUS / 2;
+        polygon.push_back(polar(radius, 2 * PI * i / n));
+    }
+    return polygon;
+}
+
+std::vector<SkeletonConstruction::Point> PolygonGenerator::spiral(int n) {
+    int armCount = std::max(n / 2, 3);
+
+    // The band is as wide as the gap between two turns, which keeps the polygon simple
+    // as long as there are enough vertices per turn.
+    double turns = std::clamp(armCount / 16.0, 0.75, 3.0);
+    double totalAngle = 2 * PI * turns;
+    double growth = (RADIUS - 10) / (totalAngle + PI);
+    double width = PI * growth;
+
+    std::vector<SkeletonConstruction::Point> polygon;
+    polygon.reserve(2 * armCount);
+    for (int i = 0; i < armCount; i++) {
+        double angle = totalAngle * i / (armCount - 1);
+        polygon.push_back(polar(10 + width + growth * angle, angle));
+    }
+    for (int i = armCount - 1; i >= 0; i--) {
+        double angle = totalAngle * i / (armCount - 1);
+        polygon.push_back(polar(10 + growth * angle, angle));
+    }
+    return polygon;
+}
+
+std::vector<SkeletonConstruction::Point> PolygonGenerator::comb(int n) {
+    int teeth = std::max((n - 4) / 4, 1);
+    double left = CENTER - RADIUS;
+    double right = CENTER + RADIUS;
+    double bottom = CENTER - RADIUS;
+    double baseTop = bottom + RADIUS / 3;
+    double top = CENTER + RADIUS;
+    double step = (right - left) / teeth;
+
+    std::vector<SkeletonConstruction::Point> polygon;
+    polygon.reserve(4 * teeth + 4);
+    polygon.emplace_back(left, bottom);
+    polygon.emplace_back(right, bottom);
+    polygon.emplace_back(right, baseTop);
+    for (int k = teeth - 1; k >= 0; k--) {
+        double toothLeft = left + k * step + step / 4;
+        double toothRight = left + k * step + 3 * step / 4;
+        polygon.emplace_back(toothRight, baseTop);
+        polygon.emplace_back(toothRight, top);
+        polygon.emplace_back(toothLeft, top);
+        polygon.emplace_back(toothLeft, baseTop);
+    }
+    polygon.emplace_back(left, baseTop);
+    return polygon;
+}
+
+std::vector<SkeletonConstruction::Point> PolygonGenerator::randomSimple(int n, std::uint32_t seed) {
+    n = std::max(n, 3);
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<double> jitter(0.0, 0.8);
+    std::uniform_real_distribution<double> radius(RADIUS / 5, RADIUS);
+
+    // One vertex per angular sector keeps the angles strictly increasing, so the
+    // polygon is star-shaped with respect to the center and therefore simple.
+    std::vector<SkeletonConstruction::Point> polygon;
+    polygon.reserve(n);
+    for (int i = 0; i < n; i++) {
+        double angle = 2 * PI * (i + jitter(rng)) / n;
+        polygon.push_back(polar(radius(rng), angle));
+    }
+    return polygon;
+}
+
+std::vector<SkeletonConstruction::Point> PolygonGenerator::reflex(int n, std::uint32_t seed) {
+    n = std::max(n / 2, 3) * 2;
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<double> jitter(-0.3, 0.3);
+    std::uniform_real_distribution<double> spike(0.6 * RADIUS, RADIUS);
+    std::uniform_real_distribution<double> notch(0.05 * RADIUS, 0.3 * RADIUS);
+
+    std::vector<SkeletonConstruction::Point> polygon;
+    polygon.reserve(n);
+    for (int i = 0; i < n; i++) {
+        double angle = 2 * PI * (i + jitter(rng)) / n;
+        polygon.push_back(polar(i % 2 == 0 ? spike(rng) : notch(rng), angle));
+    }
+    return polygon;
+}
+
+std::vector<SkeletonConstruction::Point> PolygonGenerator::nearCollinear(int n, std::uint32_t seed) {
+    int perSide = std::max(n / 4, 2);
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<double> deviation(-1e-3, 1e-3);
+    double half = RADIUS / std::sqrt(2.0);
+    const double corners[4][2] = {{-half, -half}, {half, -half}, {half, half}, {-half, half}};
+
+    std::vector<SkeletonConstruction::Point> polygon;
+    polygon.reserve(4 * perSide);
+    for (int side = 0; side < 4; side++) {
+        const double* from = corners[side];
+        const double* to = corners[(side + 1) % 4];
+        // Inward normal of a counter-clockwise side
+        double normalX = -(to[1] - from[1]) / (2 * half);
+        double normalY = (to[0] - from[0]) / (2 * half);
+        for (int i = 0; i < perSide; i++) {
+            double t = static_cast<double>(i) / perSide;
+            double offset = i == 0 ? 0.0 : deviation(rng);
+            polygon.emplace_back(CENTER + from[0] + t * (to[0] - from[0]) + offset * normalX,
+                                 CENTER + from[1] + t * (to[1] - from[1]) + offset * normalY);
+        }
+    }
+    return polygon;
+}
+
+std::vector<SkeletonConstruction::Point> PolygonGenerator::symmetric(int n, std::uint32_t seed) {
+    std::mt19937 rng(seed);
+    int folds = std::uniform_int_distribution<int>(2, 6)(rng);
+    int period = std::max(n / folds, 3);
+    std::uniform_real_distribution<double> radius(RADIUS / 4, RADIUS);
+    std::vector<double> pattern(period);
+    for (double& r : pattern) {
+        r = radius(rng);
+    }
+
+    int count = folds * period;
+    std::vector<SkeletonConstruction::Point> polygon;
+    polygon.reserve(count);
+    for (int i = 0; i < count; i++) {
+        polygon.push_back(polar(pattern[i % period], 2 * PI * i / count));
+    }
+    return polygon;
+}
+
+std::vector<SkeletonConstruction::Point> PolygonGenerator::generate(const std::string& family, int n,
+                                                                    std::uint32_t seed) {
+    if (family == "convex") return convex(n);
+    if (family == "star") return star(n);
+    if (family == "spiral") return spiral(n);
+    if (family == "comb") return comb(n);
+    if (family == "random") return randomSimple(n, seed);
+    if (family == "reflex") return reflex(n, seed);
+    if (family == "collinear") return nearCollinear(n, seed);
+    if (family == "symmetric") return symmetric(n, seed);
+    throw std::invalid_argument("Unknown polygon family: " + family);
+}
+
+std::vector<std::string> PolygonGenerator::families() {
+    return {"convex", "star", "spiral", "comb", "random", "reflex", "collinear", "symmetric"};
+}
+
+}  // namespace OneCut
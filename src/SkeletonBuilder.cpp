@@ -1,237 +1,689 @@
 #include "OneCut/SkeletonBuilder.h"
 
+#include <CGAL/Straight_skeleton_builder_2.h>
+#include <CGAL/compute_outer_frame_margin.h>
+
+#include <sstream>
+#include <stdexcept>
+
+#include "OneCut/Tracer.h"
+
 namespace SkeletonConstruction {
 
-struct PointComparator {
-    bool operator()(const Point& a, const Point& b) const {
-        if (a.x() != b.x()) return a.x() < b.x();
-        return a.y() < b.y();
+namespace {
+
+struct PointHash {
+    size_t operator()(const Point& p) const {
+        size_t hx = std::hash<double>()(p.x());
+        size_t hy = std::hash<double>()(p.y());
+        return hx ^ (hy + 0x9e3779b97f4a7c15ULL + (hx << 6) + (hx >> 2));
     }
 };
 
-const double TOLERANCE = 1e-6;
+using PolygonVertexIndex = std::unordered_map<Point, int, PointHash>;
+
+typedef CGAL::Straight_skeleton_builder_traits_2<K> SsBuilderTraits;
+typedef CGAL::Straight_skeleton_builder_2<SsBuilderTraits, Ss> SsBuilder;
+
+// Offset up to which the exterior skeleton is built without a paper; the frame around the shapes lies beyond it
+const double EXTERIOR_MAX_OFFSET = 1000;
 
-Point normalized_point(const Point& p, double tol = TOLERANCE) {
-    double new_x = std::round(p.x() / tol) * tol;
-    double new_y = std::round(p.y() / tol) * tol;
-    return Point(new_x, new_y);
+// Maps every contour vertex to its position in the concatenated rings.
+PolygonVertexIndex indexPolygonVertices(const std::vector<Point>& contourPoints) {
+    PolygonVertexIndex polygonVertexIndex;
+    polygonVertexIndex.reserve(contourPoints.size());
+    for (int i = 0; i < static_cast<int>(contourPoints.size()); i++) {
+        polygonVertexIndex.emplace(contourPoints[i], i);
+    }
+    return polygonVertexIndex;
 }
 
-// A helper to form a normalized edge key from two points.
-std::pair<Point, Point> make_normalized_edge(const Point& a, const Point& b, double tol = TOLERANCE) {
-    Point norm_a = normalized_point(a, tol);
-    Point norm_b = normalized_point(b, tol);
-    if (PointComparator()(norm_a, norm_b))
-        return {norm_a, norm_b};
-    else
-        return {norm_b, norm_a};
+// Maps the CGAL face ids of a skeleton to consecutive face indices (in iteration order) starting at offset.
+std::vector<int> indexFacesById(const SsPtr& skeleton, int offset) {
+    int maxId = -1;
+    for (auto face = skeleton->faces_begin(); face != skeleton->faces_end(); face++) {
+        maxId = std::max(maxId, face->id());
+    }
+
+    std::vector<int> faceIndexById(maxId + 1, -1);
+    int counter = offset;
+    for (auto face = skeleton->faces_begin(); face != skeleton->faces_end(); face++) {
+        faceIndexById[face->id()] = counter++;
+    }
+    return faceIndexById;
 }
 
-SkeletonBuilder::SkeletonBuilder(const std::vector<Point>& polygon_points) : originalPolygonPoints(polygon_points) {
-    // Construct the polygon from the input points
-    Polygon_2 polygon;
-    for (const auto& p : polygon_points) {
-        polygon.push_back(p);
+// Maps the CGAL vertex ids of the contour vertices of a skeleton to the index of the contour vertex
+// they were created from; all other vertices map to -1. Contour vertices are copies of the input
+// points, so the lookup is exact.
+std::vector<int> indexContourVerticesById(const SsPtr& skeleton, const PolygonVertexIndex& polygonVertexIndex) {
+    int maxId = -1;
+    for (auto vertex = skeleton->vertices_begin(); vertex != skeleton->vertices_end(); vertex++) {
+        maxId = std::max(maxId, vertex->id());
     }
 
-    if (polygon.is_clockwise_oriented()) {
-        polygon.reverse_orientation();
+    std::vector<int> polygonIndexById(maxId + 1, -1);
+    for (auto vertex = skeleton->vertices_begin(); vertex != skeleton->vertices_end(); vertex++) {
+        if (!vertex->is_contour()) {
+            continue;
+        }
+        auto it = polygonVertexIndex.find(vertex->point());
+        if (it != polygonVertexIndex.end()) {
+            polygonIndexById[vertex->id()] = it->second;
+        }
     }
+    return polygonIndexById;
+}
 
-    // Compute the straight skeleton
-    iss_ = CGAL::create_interior_straight_skeleton_2(polygon.vertices_begin(), polygon.vertices_end());
-    oss_ = CGAL::create_exterior_straight_skeleton_2(1000, polygon.vertices_begin(), polygon.vertices_end());
+// Gets the index i of the contour edge (i, contourNext[i]) a border halfedge lies on, or -1 if it is
+// not a contour edge (e.g. the frame of the exterior skeleton). Works for both orientations of the edge.
+int polygonEdgeIndex(Ss::Halfedge_handle halfedge, const std::vector<int>& polygonIndexById,
+                     const std::vector<int>& contourNext) {
+    int a = polygonIndexById[halfedge->prev()->vertex()->id()];
+    int b = polygonIndexById[halfedge->vertex()->id()];
+    if (a < 0 || b < 0) {
+        return -1;
+    }
+    if (contourNext[a] == b) {
+        return a;
+    }
+    if (contourNext[b] == a) {
+        return b;
+    }
+    return -1;
+}
 
-    if (!iss_) {
-        std::cerr << "Failed to create straight skeleton" << std::endl;
-        return;
+// Builds the straight skeleton inside the first contour and outside the others, as
+// CGAL::create_interior_straight_skeleton_2 does, but with the halfedge data structure in the arena.
+// A positive maxOffset stops the construction at that offset, as for the partial skeleton.
+SsPtr constructSkeleton(const std::vector<Polygon_2>& contours, OneCut::Arena& arena, double maxOffset = 0) {
+    OneCut::TraceSpan span("construct skeleton", "skeleton");
+    if (span.enabled()) {
+        size_t vertexCount = 0;
+        for (const Polygon_2& contour : contours) {
+            vertexCount += contour.size();
+        }
+        span.arg("contours", static_cast<std::int64_t>(contours.size()));
+        span.arg("vertices", static_cast<std::int64_t>(vertexCount));
+    }
+
+    // The builder creates the skeleton, which binds its allocator to the current arena
+    OneCut::ArenaScope scope(&arena);
+    std::unique_ptr<SsBuilder> builder =
+        maxOffset > 0 ? std::make_unique<SsBuilder>(maxOffset) : std::make_unique<SsBuilder>();
+    for (const Polygon_2& contour : contours) {
+        builder->enter_contour(contour.vertices_begin(), contour.vertices_end());
+    }
+    return builder->construct_skeleton();
+}
+
+// The outer boundary of a shape followed by its holes.
+std::vector<Polygon_2> contoursOf(const Polygon_with_holes_2& shape) {
+    std::vector<Polygon_2> contours = {shape.outer_boundary()};
+    contours.insert(contours.end(), shape.holes_begin(), shape.holes_end());
+    return contours;
+}
+
+// Copies a ring with the opposite orientation.
+Polygon_2 reversed(Polygon_2 ring) {
+    ring.reverse_orientation();
+    return ring;
+}
+
+// Appends the start vertex of a halfedge and the face on the other side of it to a compact skeleton.
+void addVertex(OneCut::CompactSkeleton& faces, Ss::Halfedge_handle halfedge, int adjacentFace, int twinEdge = -1) {
+    const Point& startPoint = halfedge->prev()->vertex()->point();
+    faces.addVertex(startPoint.x(), startPoint.y(), adjacentFace, twinEdge);
+}
+
+// Vertex of a face being clipped; edge is the original index of the edge starting at it, -1 on the paper border
+struct ClipVertex {
+    double x;
+    double y;
+    int edge;
+};
+
+// Point where the segment between a and b crosses the line coordinate[axis] == border. The end points
+// are ordered first, so the two faces sharing an edge get the same point.
+ClipVertex borderCrossing(ClipVertex a, ClipVertex b, int axis, double border) {
+    if (std::make_pair(b.x, b.y) < std::make_pair(a.x, a.y)) {
+        std::swap(a, b);
+    }
+    if (axis == 0) {
+        double t = (border - a.x) / (b.x - a.x);
+        return {border, a.y + t * (b.y - a.y), -1};
+    }
+    double t = (border - a.y) / (b.y - a.y);
+    return {a.x + t * (b.x - a.x), border, -1};
+}
+
+// Sutherland-Hodgman step: keeps the part of a ring on one side of a paper border. Every
+// original edge is clipped to at most one piece, which keeps its index.
+std::vector<ClipVertex> clipRing(const std::vector<ClipVertex>& ring, int axis, double border, bool keepBelow) {
+    auto inside = [&](const ClipVertex& v) {
+        double coordinate = axis == 0 ? v.x : v.y;
+        return keepBelow ? coordinate <= border : coordinate >= border;
+    };
+
+    std::vector<ClipVertex> clipped;
+    clipped.reserve(ring.size() + 2);
+    for (size_t i = 0; i < ring.size(); i++) {
+        const ClipVertex& current = ring[i];
+        const ClipVertex& next = ring[(i + 1) % ring.size()];
+        bool currentInside = inside(current);
+        if (currentInside) {
+            clipped.push_back(current);
+        }
+        if (currentInside != inside(next)) {
+            // Leaving: the border follows the crossing; entering: the rest of the edge does
+            ClipVertex crossing = borderCrossing(current, next, axis, border);
+            crossing.edge = currentInside ? -1 : current.edge;
+            clipped.push_back(crossing);
+        }
+    }
+    return clipped;
+}
+
+// Clips a face to the paper. Returns the remaining ring starting with the cut edge (original
+// edge 0), or an empty ring if the face has no area on the paper or its cut edge lies off it.
+std::vector<ClipVertex> clipFace(const OneCut::CompactFace& face, const OneCut::Paper& paper) {
+    std::vector<ClipVertex> ring;
+    ring.reserve(face.vertexCount());
+    for (size_t i = 0; i < face.vertexCount(); i++) {
+        ring.push_back({face.x(i), face.y(i), static_cast<int>(i)});
+    }
+    ring = clipRing(ring, 0, paper.xMin, false);
+    ring = clipRing(ring, 0, paper.xMax, true);
+    ring = clipRing(ring, 1, paper.yMin, false);
+    ring = clipRing(ring, 1, paper.yMax, true);
+
+    // Vertices on the border may have been emitted twice
+    std::vector<ClipVertex> distinct;
+    distinct.reserve(ring.size());
+    for (size_t i = 0; i < ring.size(); i++) {
+        const ClipVertex& next = ring[(i + 1) % ring.size()];
+        if (ring[i].x != next.x || ring[i].y != next.y) {
+            distinct.push_back(ring[i]);
+        }
+    }
+
+    auto cutEdge = std::find_if(distinct.begin(), distinct.end(), [](const ClipVertex& v) { return v.edge == 0; });
+    if (distinct.size() < 3 || cutEdge == distinct.end()) {
+        return {};
+    }
+    std::rotate(distinct.begin(), cutEdge, distinct.end());
+    return distinct;
+}
+
+// Tracks the position of every converted halfedge in its face, so the twin of each edge
+// (the position of the opposite halfedge) can be filled in once all faces are converted.
+class TwinEdgeResolver {
+   public:
+    explicit TwinEdgeResolver(const SsPtr& skeleton) {
+        int maxId = -1;
+        for (auto halfedge = skeleton->halfedges_begin(); halfedge != skeleton->halfedges_end(); halfedge++) {
+            maxId = std::max(maxId, halfedge->id());
+        }
+        slotById.assign(maxId + 1, -1);
+        oppositeIds.reserve(skeleton->size_of_halfedges() / 2);
+    }
+
+    // Records the halfedge converted to edge `slot` of its face; border halfedges have no twin here
+    void add(Ss::Halfedge_handle halfedge, int slot, bool hasTwin) {
+        slotById[halfedge->id()] = slot;
+        oppositeIds.push_back(hasTwin ? halfedge->opposite()->id() : -1);
+    }
+
+    // Sets the twin of every recorded edge; edges were recorded in the vertex order of faces
+    void resolve(OneCut::CompactSkeleton& faces) const {
+        const std::vector<int>& faceOffsets = faces.getFaceOffsets();
+        for (int face = 0; face < static_cast<int>(faces.faceCount()); face++) {
+            for (int vertex = faceOffsets[face]; vertex < faceOffsets[face + 1]; vertex++) {
+                if (oppositeIds[vertex] >= 0) {
+                    faces.setTwinEdgeIndex(face, vertex - faceOffsets[face], slotById[oppositeIds[vertex]]);
+                }
+            }
+        }
+    }
+
+   private:
+    std::vector<int> slotById;     ///< Position of each halfedge in its face
+    std::vector<int> oppositeIds;  ///< Opposite halfedge id per converted edge, -1 for border edges
+};
+
+}  // namespace
+
+SkeletonBuilder::SkeletonBuilder(const std::vector<Point>& polygon_points, ExteriorMode exteriorMode,
+                                 std::optional<OneCut::Paper> paper)
+    : SkeletonBuilder(std::vector<Polygon_with_holes_2>{Polygon_with_holes_2(
+                          Polygon_2(polygon_points.begin(), polygon_points.end()))},
+                      exteriorMode, paper) {}
+
+SkeletonBuilder::SkeletonBuilder(const std::vector<Polygon_with_holes_2>& inputShapes, ExteriorMode exteriorMode,
+                                 std::optional<OneCut::Paper> paper)
+    : arena(std::make_unique<OneCut::Arena>()), paper(paper) {
+    // Orient outer boundaries counter-clockwise and holes clockwise, as CGAL expects them
+    shapes.reserve(inputShapes.size());
+    for (const Polygon_with_holes_2& inputShape : inputShapes) {
+        Polygon_2 outer = inputShape.outer_boundary();
+        if (outer.is_clockwise_oriented()) {
+            outer.reverse_orientation();
+        }
+        addContour(outer);
+
+        Polygon_with_holes_2 shape(outer);
+        for (auto hole = inputShape.holes_begin(); hole != inputShape.holes_end(); hole++) {
+            Polygon_2 ring = *hole;
+            if (ring.is_counterclockwise_oriented()) {
+                ring.reverse_orientation();
+            }
+            addContour(ring);
+            shape.add_hole(ring);
+        }
+        shapes.push_back(shape);
     }
-    CGAL::Straight_skeletons_2::IO::print_straight_skeleton(*iss_);
 
-    if (!iss_) {
-        std::cerr << "Failed to create exterior skeleton" << std::endl;
+    if (paper) {
+        for (const Point& point : contourPoints) {
+            if (!paper->contains(point.x(), point.y())) {
+                std::ostringstream message;
+                message << "Polygon vertex (" << point.x() << ", " << point.y() << ") lies off the paper ["
+                        << paper->xMin << ", " << paper->xMax << "] x [" << paper->yMin << ", " << paper->yMax << "]";
+                throw std::invalid_argument(message.str());
+            }
+        }
+    }
+    stats.polygonVertexCount = contourPoints.size();
+
+    // Compute the straight skeleton of every shape
+    OneCut::StageTimer interiorTimer;
+    OneCut::TraceSpan interiorSpan("interior skeleton", "skeleton");
+    for (const Polygon_with_holes_2& shape : shapes) {
+        SsPtr skeleton = constructSkeleton(contoursOf(shape), *arena);
+        if (!skeleton) {
+            iss_.clear();
+            break;
+        }
+        iss_.push_back(skeleton);
+    }
+    stats.interiorSkeletonMs = interiorTimer.elapsedMs();
+    interiorSpan.finish();
+    stats.arenaBytes = arena->bytesAllocated();
+
+    if (iss_.empty()) {
+        ONECUT_DIAGNOSTIC("Failed to create straight skeleton");
         return;
     }
-    CGAL::Straight_skeletons_2::IO::print_straight_skeleton(*oss_);
 
-    facesInner = innerSkeletonToFaces(iss_, 0);
-    facesOuter = outerSkeletonToFaces(oss_, facesInner.size());
+    OneCut::StageTimer innerTimer;
+    PolygonVertexIndex polygonVertexIndex = indexPolygonVertices(contourPoints);
+    polygonEdgeInnerFace.assign(contourPoints.size(), -1);
+    polygonEdgeInnerSlot.assign(contourPoints.size(), -1);
+    for (const SsPtr& skeleton : iss_) {
+        ONECUT_DIAGNOSTIC("Interior skeleton: " << skeleton->size_of_vertices() << " vertices, "
+                                                << skeleton->size_of_halfedges() << " halfedges, "
+                                                << skeleton->size_of_faces() << " faces");
+        OneCut::TraceSpan pass("inner faces", "skeleton");
+        pass.arg("faces", static_cast<std::int64_t>(skeleton->size_of_faces()));
+        facesInner.append(innerSkeletonToFaces(skeleton, facesInner.faceCount(),
+                                               indexContourVerticesById(skeleton, polygonVertexIndex)));
+    }
+    stats.innerFacesMs = innerTimer.elapsedMs();
+
+    stats.innerFaceCount = facesInner.faceCount();
+    stats.faceVertexCount = facesInner.vertexCount();
+    stats.totalMs = stats.interiorSkeletonMs + stats.innerFacesMs;
 
-    // Combine inner and outer faces into a single vector
-    faces.reserve(facesInner.size() + facesOuter.size());
-    faces.insert(faces.end(), facesInner.begin(), facesInner.end());
-    faces.insert(faces.end(), facesOuter.begin(), facesOuter.end());
+    if (exteriorMode == ExteriorMode::EAGER) {
+        buildExterior();
+    }
 }
 
 OneCut::StraightSkeleton SkeletonBuilder::buildSkeleton() {
-    return OneCut::StraightSkeleton(faces);
+    return OneCut::StraightSkeleton(buildCompactSkeleton().toFaces());
 }
 
-std::vector<OneCut::SkeletonFace> SkeletonBuilder::innerSkeletonToFaces(SsPtr skeleton, int offset) {
-    std::vector<OneCut::SkeletonFace> faces;
-    faces.reserve(this->originalPolygonPoints.size());
+OneCut::CompactSkeleton SkeletonBuilder::buildCompactSkeleton() {
+    buildExterior();
+    if (oss_.empty()) {
+        return OneCut::CompactSkeleton();
+    }
 
-    std::map<Ss::Face_handle, int> faceIndexMap;
-    std::vector<std::pair<int, OneCut::SkeletonFace>> indexedFaces;
+    // Combine inner and outer faces into a single skeleton
+    OneCut::CompactSkeleton skeleton;
+    skeleton.reserve(facesInner.faceCount() + facesOuter.faceCount(),
+                     facesInner.vertexCount() + facesOuter.vertexCount());
+    skeleton.append(facesInner);
+    skeleton.append(facesOuter);
+    return skeleton;
+}
 
-    // iterate through all faces of the skeleton
-    int counter = 0;
-    for (auto face = skeleton->faces_begin(); face != skeleton->faces_end(); face++) {
-        faceIndexMap.emplace(face, counter);
-        counter++;
+OneCut::StraightSkeleton SkeletonBuilder::buildInteriorSkeleton() const {
+    return OneCut::StraightSkeleton(buildCompactInteriorSkeleton().toFaces());
+}
+
+OneCut::CompactSkeleton SkeletonBuilder::buildCompactInteriorSkeleton() const {
+    OneCut::CompactSkeleton skeleton = facesInner;
+
+    // Border edges may already point to outer faces, which are not part of this skeleton
+    int innerFaceCount = skeleton.faceCount();
+    for (int faceIndex = 0; faceIndex < innerFaceCount; faceIndex++) {
+        const OneCut::CompactFace& face = skeleton.face(faceIndex);
+        for (int edgeIndex = 0; edgeIndex < static_cast<int>(face.vertexCount()); edgeIndex++) {
+            if (face.adjacentFaceIndex(edgeIndex) >= innerFaceCount) {
+                skeleton.setAdjacentFaceIndex(faceIndex, edgeIndex, -1);
+                skeleton.setTwinEdgeIndex(faceIndex, edgeIndex, -1);
+            }
+        }
+    }
+    return skeleton;
+}
+
+bool SkeletonBuilder::hasExterior() const {
+    return exteriorBuilt;
+}
+
+void SkeletonBuilder::buildExterior() {
+    if (exteriorBuilt || iss_.empty()) {
+        return;
+    }
+    exteriorBuilt = true;
+
+    OneCut::StageTimer exteriorTimer;
+    OneCut::TraceSpan exteriorSpan("exterior skeleton", "skeleton");
+
+    // Each shape lies in the smallest hole of another shape containing it, or at the top level
+    std::vector<const Polygon_2*> holes;
+    for (const Polygon_with_holes_2& shape : shapes) {
+        for (auto hole = shape.holes_begin(); hole != shape.holes_end(); hole++) {
+            holes.push_back(&*hole);
+        }
+    }
+    std::vector<std::vector<Polygon_2>> islandsByHole(holes.size());
+    std::vector<const Polygon_2*> topLevel;
+    for (const Polygon_with_holes_2& shape : shapes) {
+        const Point& probe = shape.outer_boundary().vertex(0);
+        int container = -1;
+        for (int hole = 0; hole < static_cast<int>(holes.size()); hole++) {
+            if (holes[hole]->has_on_bounded_side(probe) &&
+                (container < 0 || std::abs(holes[hole]->area()) < std::abs(holes[container]->area()))) {
+                container = hole;
+            }
+        }
+        if (container >= 0) {
+            islandsByHole[container].push_back(reversed(shape.outer_boundary()));
+        } else {
+            topLevel.push_back(&shape.outer_boundary());
+        }
+    }
+
+    // With a paper the skeleton only has to reach its farthest point. The distance of a paper point to
+    // the shapes is at most its distance to one shape vertex, which is largest at a paper corner.
+    double maxOffset = EXTERIOR_MAX_OFFSET;
+    if (paper && !topLevel.empty() && std::isfinite(paper->xMax - paper->xMin) &&
+        std::isfinite(paper->yMax - paper->yMin)) {
+        const Point& vertex = topLevel.front()->vertex(0);
+        double dx = std::max(vertex.x() - paper->xMin, paper->xMax - vertex.x());
+        double dy = std::max(vertex.y() - paper->yMin, paper->yMax - vertex.y());
+        maxOffset = std::sqrt(dx * dx + dy * dy) + 1;
+    }
+
+    // The frame region: a rectangle around all top-level shapes, placed as
+    // CGAL::create_exterior_straight_skeleton_2 places it around a single polygon
+    double margin = 0;
+    CGAL::Bbox_2 bbox;
+    bool frameValid = !topLevel.empty();
+    for (size_t i = 0; i < topLevel.size() && frameValid; i++) {
+        const Polygon_2& ring = *topLevel[i];
+        auto ringMargin = CGAL::compute_outer_frame_margin(ring.vertices_begin(), ring.vertices_end(),
+                                                           maxOffset);
+        frameValid = static_cast<bool>(ringMargin);
+        if (frameValid) {
+            margin = std::max(margin, CGAL::to_double(*ringMargin));
+            CGAL::Bbox_2 ringBox = CGAL::bbox_2(ring.vertices_begin(), ring.vertices_end());
+            bbox = i == 0 ? ringBox : bbox + ringBox;
+        }
+    }
+
+    SsPtr frameSkeleton;
+    if (frameValid) {
+        Point frame[4] = {Point(bbox.xmin() - margin, bbox.ymin() - margin),
+                          Point(bbox.xmax() + margin, bbox.ymin() - margin),
+                          Point(bbox.xmax() + margin, bbox.ymax() + margin),
+                          Point(bbox.xmin() - margin, bbox.ymax() + margin)};
+        std::vector<Polygon_2> contours = {Polygon_2(frame, frame + 4)};
+        for (const Polygon_2* ring : topLevel) {
+            contours.push_back(reversed(*ring));
+        }
+        frameSkeleton = constructSkeleton(contours, *arena, maxOffset);
+    }
+
+    // The inside of every hole, minus the shapes lying in it
+    if (frameSkeleton) {
+        oss_.push_back(frameSkeleton);
+        for (size_t hole = 0; hole < holes.size(); hole++) {
+            std::vector<Polygon_2> contours = {reversed(*holes[hole])};
+            contours.insert(contours.end(), islandsByHole[hole].begin(), islandsByHole[hole].end());
+            SsPtr skeleton = constructSkeleton(contours, *arena);
+            if (!skeleton) {
+                oss_.clear();
+                break;
+            }
+            oss_.push_back(skeleton);
+        }
+    }
+    stats.exteriorSkeletonMs = exteriorTimer.elapsedMs();
+    exteriorSpan.finish();
+    stats.arenaBytes = arena->bytesAllocated();
+
+    if (oss_.empty()) {
+        ONECUT_DIAGNOSTIC("Failed to create exterior skeleton");
+        return;
+    }
+
+    OneCut::StageTimer outerTimer;
+    PolygonVertexIndex polygonVertexIndex = indexPolygonVertices(contourPoints);
+    for (const SsPtr& skeleton : oss_) {
+        ONECUT_DIAGNOSTIC("Exterior skeleton: " << skeleton->size_of_vertices() << " vertices, "
+                                                << skeleton->size_of_halfedges() << " halfedges, "
+                                                << skeleton->size_of_faces() << " faces");
+        OneCut::TraceSpan pass("outer faces", "skeleton");
+        pass.arg("faces", static_cast<std::int64_t>(skeleton->size_of_faces()));
+        facesOuter.append(outerSkeletonToFaces(skeleton, facesInner.faceCount() + facesOuter.faceCount(),
+                                               indexContourVerticesById(skeleton, polygonVertexIndex)));
+    }
+    if (paper) {
+        clipOuterFaces(*paper);
+    }
+    stats.outerFacesMs = outerTimer.elapsedMs();
+
+    stats.outerFaceCount = facesOuter.faceCount();
+    stats.faceVertexCount += facesOuter.vertexCount();
+    stats.totalMs += stats.exteriorSkeletonMs + stats.outerFacesMs;
+}
+
+void SkeletonBuilder::clipOuterFaces(const OneCut::Paper& paper) {
+    OneCut::TraceSpan span("clip outer faces", "skeleton");
+    int innerFaceCount = facesInner.faceCount();
+    int outerFaceCount = facesOuter.faceCount();
+
+    // New index of every edge of every outer face, -1 if it was clipped away
+    std::vector<std::vector<int>> edgeMaps(outerFaceCount);
+    OneCut::CompactSkeleton clipped;
+    clipped.reserve(outerFaceCount, facesOuter.vertexCount());
+    for (int faceIndex = 0; faceIndex < outerFaceCount; faceIndex++) {
+        const OneCut::CompactFace& face = facesOuter.face(faceIndex);
+        std::span<const int> twinEdges = face.twinEdgeSpan();
+        std::vector<int>& edgeMap = edgeMaps[faceIndex];
+        edgeMap.assign(face.vertexCount(), -1);
+
+        bool onPaper = true;
+        for (size_t i = 0; i < face.vertexCount() && onPaper; i++) {
+            onPaper = paper.contains(face.x(i), face.y(i));
+        }
+        std::vector<ClipVertex> ring;
+        if (onPaper) {
+            for (size_t i = 0; i < face.vertexCount(); i++) {
+                ring.push_back({face.x(i), face.y(i), static_cast<int>(i)});
+            }
+        } else {
+            ring = clipFace(face, paper);
+            stats.clippedOuterFaces++;
+        }
+
+        // Adjacency is copied for now and remapped below, once all faces are clipped
+        for (int i = 0; i < static_cast<int>(ring.size()); i++) {
+            int edge = ring[i].edge;
+            if (edge < 0) {
+                clipped.addVertex(ring[i].x, ring[i].y, -1);
+                continue;
+            }
+            edgeMap[edge] = i;
+            int twinEdge = twinEdges.empty() ? -1 : twinEdges[edge];
+            clipped.addVertex(ring[i].x, ring[i].y, face.adjacentFaceIndex(edge), twinEdge);
+        }
+        clipped.closeFace(true);
+    }
+
+    // Edges next to an outer face get the new index of their twin, or lose the neighbour if it was clipped away
+    auto remap = [&](OneCut::CompactSkeleton& faces, int faceIndex, int edgeIndex, int adjacentFace, int twinEdge) {
+        if (adjacentFace < innerFaceCount) {
+            return;
+        }
+        int adjacentOuterFace = adjacentFace - innerFaceCount;
+        int newTwin = twinEdge >= 0 ? edgeMaps[adjacentOuterFace][twinEdge] : -1;
+        if (clipped.face(adjacentOuterFace).vertexCount() == 0 || (twinEdge >= 0 && newTwin < 0)) {
+            faces.setAdjacentFaceIndex(faceIndex, edgeIndex, -1);
+        }
+        faces.setTwinEdgeIndex(faceIndex, edgeIndex, newTwin);
+    };
+    for (OneCut::CompactSkeleton* faces : {&facesInner, &clipped}) {
+        for (int faceIndex = 0; faceIndex < static_cast<int>(faces->faceCount()); faceIndex++) {
+            const OneCut::CompactFace& face = faces->face(faceIndex);
+            std::span<const int> twinEdges = face.twinEdgeSpan();
+            for (int edgeIndex = 0; edgeIndex < static_cast<int>(face.vertexCount()); edgeIndex++) {
+                remap(*faces, faceIndex, edgeIndex, face.adjacentFaceIndex(edgeIndex),
+                      twinEdges.empty() ? -1 : twinEdges[edgeIndex]);
+            }
+        }
     }
+    facesOuter = std::move(clipped);
+}
+
+void SkeletonBuilder::addContour(const Polygon_2& ring) {
+    int first = contourPoints.size();
+    int size = ring.size();
+    for (int i = 0; i < size; i++) {
+        contourPoints.push_back(ring.vertex(i));
+        contourNext.push_back(first + (i + 1) % size);
+    }
+}
+
+const OneCut::PipelineStats& SkeletonBuilder::getStats() const {
+    return stats;
+}
 
-    // get the adjacent faces of the face for every face in the map
-    for (const auto& faceIndexPair : faceIndexMap) {
-        Ss::Face_handle face = faceIndexPair.first;
+OneCut::CompactSkeleton SkeletonBuilder::innerSkeletonToFaces(SsPtr skeleton, int offset,
+                                                              const std::vector<int>& polygonIndexById) {
+    OneCut::CompactSkeleton faces;
+    faces.reserve(skeleton->size_of_faces(), skeleton->size_of_halfedges());
+
+    std::vector<int> faceIndexById = indexFacesById(skeleton, offset);
+    TwinEdgeResolver twinEdges(skeleton);
+
+    // faces are visited in iteration order, which is also their index order
+    for (auto face = skeleton->faces_begin(); face != skeleton->faces_end(); face++) {
+        int faceIndex = faceIndexById[face->id()];
 
         // go through the face halfedges in a circle
         Ss::Halfedge_handle start = face->halfedge();
         Ss::Halfedge_handle halfedgeIterator = start;
 
-        std::vector<Point> points;
-        std::vector<int> adjacentFaces;
+        int edgeCount = 0;
 
         do {
-            // for each halfedge get first point and second point and get the opposite face
-            Point startPoint = halfedgeIterator->prev()->vertex()->point();
-            Point endPoint = halfedgeIterator->vertex()->point();
-
             Ss::Face_handle oppositeFace = halfedgeIterator->opposite()->face();
             if (oppositeFace == nullptr) {
                 // Opposite face is null <=> the halfedge is a border edge
-                // map the edge of the polygon to this face
-                polyEdgeToFaceIndexMap.emplace(make_normalized_edge(startPoint, endPoint), faceIndexPair.second);
-
-                points.push_back(startPoint);
-                adjacentFaces.push_back(-1);
-                halfedgeIterator = halfedgeIterator->next();
-                continue;
+                // remember which face (and which of its edges) lies on this contour edge
+                int edgeIndex = polygonEdgeIndex(halfedgeIterator, polygonIndexById, contourNext);
+                if (edgeIndex >= 0) {
+                    polygonEdgeInnerFace[edgeIndex] = faceIndex;
+                    polygonEdgeInnerSlot[edgeIndex] = edgeCount;
+                }
+                addVertex(faces, halfedgeIterator, -1);
+                twinEdges.add(halfedgeIterator, edgeCount, false);
             } else if (oppositeFace == face) {
                 halfedgeIterator = halfedgeIterator->next();
                 continue;
             } else {
-                // use the opposite face to lookup the face index in the map
-                int oppositeFaceIndex = faceIndexMap[oppositeFace];
-                points.push_back(startPoint);
-                adjacentFaces.push_back(oppositeFaceIndex);
-                halfedgeIterator = halfedgeIterator->next();
+                addVertex(faces, halfedgeIterator, faceIndexById[oppositeFace->id()]);
+                twinEdges.add(halfedgeIterator, edgeCount, true);
             }
+            edgeCount++;
+            halfedgeIterator = halfedgeIterator->next();
         } while (halfedgeIterator != start);
 
-        std::vector<OneCut::Point> epeckPoints;
-        epeckPoints.reserve(points.size());
-        for (const Point& point : points) {
-            epeckPoints.emplace_back(convertPoint(point));
-        }
-
-        OneCut::SkeletonFace sFace(epeckPoints, adjacentFaces);
-        sFace.isOuter = false;
-        indexedFaces.emplace_back(faceIndexPair.second, sFace);
-    }
-    std::sort(indexedFaces.begin(), indexedFaces.end(), [](const auto& a, const auto& b) { return a.first < b.first; });
-
-    for (const auto& pair : indexedFaces) {
-        faces.push_back(pair.second);
+        faces.closeFace(false);
     }
 
-    // std::cout << std::endl << "FACES: " << std::endl;
-    // for (const OneCut::SkeletonFace& face : faces) {
-    //     std::cout << face << std::endl;
-    // }
-
+    twinEdges.resolve(faces);
     return faces;
 }
 
-std::vector<OneCut::SkeletonFace> SkeletonBuilder::outerSkeletonToFaces(SsPtr skeleton, int offset) {
-    std::vector<OneCut::SkeletonFace> faces;
-    faces.reserve(this->originalPolygonPoints.size());
+OneCut::CompactSkeleton SkeletonBuilder::outerSkeletonToFaces(SsPtr skeleton, int offset,
+                                                              const std::vector<int>& polygonIndexById) {
+    OneCut::CompactSkeleton faces;
+    faces.reserve(skeleton->size_of_faces(), skeleton->size_of_halfedges());
 
-    std::map<Ss::Face_handle, int> faceIndexMap;
-    std::vector<std::pair<int, OneCut::SkeletonFace>> indexedFaces;
+    std::vector<int> faceIndexById = indexFacesById(skeleton, offset);
+    TwinEdgeResolver twinEdges(skeleton);
 
-    // iterate through all faces of the skeleton
-    int counter = 0 + offset;
+    // faces are visited in iteration order, which is also their index order
     for (auto face = skeleton->faces_begin(); face != skeleton->faces_end(); face++) {
-        faceIndexMap.emplace(face, counter);
-        counter++;
-    }
-
-    // get the adjacent faces of the face for every face in the map
-    for (const auto& faceIndexPair : faceIndexMap) {
-        Ss::Face_handle face = faceIndexPair.first;
+        int faceIndex = faceIndexById[face->id()];
 
-        // through the face halfedges in a circle
+        // go through the face halfedges in a circle
         Ss::Halfedge_handle start = face->halfedge();
         Ss::Halfedge_handle halfedgeIterator = start;
 
-        std::vector<Point> points;
-        std::vector<int> adjacentFaces;
+        int edgeCount = 0;
 
         do {
-            // for each halfedge get first point and second point and get the opposite face
-            Point startPoint = halfedgeIterator->prev()->vertex()->point();
-            Point endPoint = halfedgeIterator->vertex()->point();;
-
             Ss::Face_handle oppositeFace = halfedgeIterator->opposite()->face();
             if (oppositeFace == nullptr) {
                 // Opposite face is null <=> the halfedge is a border edge
-                // figure out if the edge is similar to the edge of the polygon
-                auto it = polyEdgeToFaceIndexMap.find(make_normalized_edge(startPoint, endPoint));
-                if (it != polyEdgeToFaceIndexMap.end()) {
-                    // add the face index to the adjacent faces
-                    adjacentFaces.push_back(it->second);
-
-                    OneCut::SkeletonFace& innerFace = facesInner[it->second];
-                    std::replace(innerFace.adjacentFaces.begin(), innerFace.adjacentFaces.end(), -1,
-                                 faceIndexPair.second);
-
+                // contour edges connect to the inner face on the other side, the frame has no neighbour
+                int edgeIndex = polygonEdgeIndex(halfedgeIterator, polygonIndexById, contourNext);
+                int innerFaceIndex = edgeIndex >= 0 ? polygonEdgeInnerFace[edgeIndex] : -1;
+                int innerSlot = -1;
+                if (innerFaceIndex >= 0) {
+                    innerSlot = polygonEdgeInnerSlot[edgeIndex];
+                    facesInner.setAdjacentFaceIndex(innerFaceIndex, innerSlot, faceIndex);
+                    facesInner.setTwinEdgeIndex(innerFaceIndex, innerSlot, edgeCount);
                 } else {
-                    std::cout << "Edge not found in map: " << startPoint << " " << endPoint << std::endl;
-                    adjacentFaces.push_back(-1);
+                    ONECUT_DIAGNOSTIC("Edge not found in polygon: " << halfedgeIterator->prev()->vertex()->point()
+                                                                    << " " << halfedgeIterator->vertex()->point());
+                    stats.edgeMapMisses++;
                 }
-
-                points.push_back(startPoint);
-                halfedgeIterator = halfedgeIterator->next();
-                continue;
+                addVertex(faces, halfedgeIterator, innerFaceIndex, innerSlot);
+                twinEdges.add(halfedgeIterator, edgeCount, false);
             } else if (oppositeFace == face) {
                 halfedgeIterator = halfedgeIterator->next();
                 continue;
             } else {
-                // use the opposite face to lookup the face index in the map
-                int oppositeFaceIndex = faceIndexMap[oppositeFace];
-                points.push_back(startPoint);
-                adjacentFaces.push_back(oppositeFaceIndex);
-                halfedgeIterator = halfedgeIterator->next();
+                addVertex(faces, halfedgeIterator, faceIndexById[oppositeFace->id()]);
+                twinEdges.add(halfedgeIterator, edgeCount, true);
             }
+            edgeCount++;
+            halfedgeIterator = halfedgeIterator->next();
         } while (halfedgeIterator != start);
 
-        std::vector<OneCut::Point> epeckPoints;
-        epeckPoints.reserve(points.size());
-        for (const Point& point : points) {
-            epeckPoints.emplace_back(convertPoint(point));
-        }
-
-        OneCut::SkeletonFace sFace(epeckPoints, adjacentFaces);
-        sFace.isOuter = true;
-        indexedFaces.emplace_back(faceIndexPair.second, sFace);
+        faces.closeFace(true);
     }
-    std::sort(indexedFaces.begin(), indexedFaces.end(), [](const auto& a, const auto& b) { return a.first < b.first; });
-
-    for (const auto& pair : indexedFaces) {
-        faces.push_back(pair.second);
-    }
-
-    // std::cout << std::endl << "FACES: " << std::endl;
-    // for (const OneCut::SkeletonFace& face : faces) {
-    //     std::cout << face << std::endl;
-    // }
 
+    twinEdges.resolve(faces);
     return faces;
 }
 
-OneCut::Point SkeletonBuilder::convertPoint(const Point& point) const {
-    return OneCut::Point(point.x(), point.y());
-}
-
 }  // namespace SkeletonConstruction
\ No newline at end of file
@@ -2,49 +2,84 @@
 
 namespace OneCut {
 
-SkeletonFace::SkeletonFace(const std::vector<Point>& vertices, const std::vector<int>& adjacentFaces) : vertices(vertices), adjacentFaces(adjacentFaces) {}
+template <class Kernel>
+BasicSkeletonFace<Kernel>::BasicSkeletonFace(const std::vector<KernelPoint>& vertices,
+                                             const std::vector<int>& adjacentFaces)
+    : vertices(vertices), adjacentFaces(adjacentFaces) {}
 
-size_t SkeletonFace::vertexCount() const {
+template <class Kernel>
+size_t BasicSkeletonFace<Kernel>::vertexCount() const {
     return vertices.size();
 }
 
-Point SkeletonFace::vertex(size_t i) const {
-    return vertices[i];
+template <class Kernel>
+Point BasicSkeletonFace<Kernel>::vertex(size_t i) const {
+    return convertPoint<ExactKernel>(vertices[i]);
 }
 
-std::vector<Point> SkeletonFace::getVertices() const {
-    return vertices;
+template <class Kernel>
+std::vector<Point> BasicSkeletonFace<Kernel>::getVertices() const {
+    if constexpr (std::is_same_v<Kernel, ExactKernel>) {
+        return vertices;
+    } else {
+        std::vector<Point> converted;
+        converted.reserve(vertices.size());
+        for (const KernelPoint& vertex : vertices) {
+            converted.push_back(convertPoint<ExactKernel>(vertex));
+        }
+        return converted;
+    }
 }
 
-std::vector<int> SkeletonFace::getAdjacentFaces() const {
+template <class Kernel>
+std::vector<int> BasicSkeletonFace<Kernel>::getAdjacentFaces() const {
     return adjacentFaces;
 }
 
-int SkeletonFace::adjacentFaceIndex(int i) const {
+template <class Kernel>
+std::span<const int> BasicSkeletonFace<Kernel>::adjacentFaceSpan() const {
+    return adjacentFaces;
+}
+
+template <class Kernel>
+std::span<const int> BasicSkeletonFace<Kernel>::twinEdgeSpan() const {
+    return twinEdges;
+}
+
+template <class Kernel>
+int BasicSkeletonFace<Kernel>::adjacentFaceIndex(int i) const {
     return adjacentFaces[i];
 }
 
-std::ostream& SkeletonFace::print(std::ostream& os) const {
+template <class Kernel>
+std::ostream& BasicSkeletonFace<Kernel>::print(std::ostream& os) const {
     os << "{ \"vertices\": [";
-    {
-        const auto& verts = this->getVertices();
-        for (size_t i = 0; i < verts.size(); ++i) {
-            os << verts[i];
-            if (i != verts.size() - 1)
-                os << ", ";
-        }
+    for (size_t i = 0; i < vertices.size(); ++i) {
+        os << vertices[i];
+        if (i != vertices.size() - 1)
+            os << ", ";
     }
     os << "], \"adjacentFaces\": [";
-    {
-        const auto& adjFaces = this->getAdjacentFaces();
-        for (size_t i = 0; i < adjFaces.size(); ++i) {
-            os << adjFaces[i];
-            if (i != adjFaces.size() - 1)
-                os << ", ";
-        }
+    for (size_t i = 0; i < adjacentFaces.size(); ++i) {
+        os << adjacentFaces[i];
+        if (i != adjacentFaces.size() - 1)
+            os << ", ";
     }
     os << "] }";
     return os;
 }
 
-}  // namespace OneCut
\ No newline at end of file
+template <class Kernel>
+const typename BasicSkeletonFace<Kernel>::KernelPoint& BasicSkeletonFace<Kernel>::point(size_t i) const {
+    return vertices[i];
+}
+
+template <class Kernel>
+std::span<const typename BasicSkeletonFace<Kernel>::KernelPoint> BasicSkeletonFace<Kernel>::vertexSpan() const {
+    return vertices;
+}
+
+template class BasicSkeletonFace<ExactKernel>;
+template class BasicSkeletonFace<FastKernel>;
+
+}  // namespace OneCut
@@ -16,4 +16,8 @@ std::vector<SkeletonFace> StraightSkeleton::getFaces() const {
     return faces;
 }
 
+std::span<const SkeletonFace> StraightSkeleton::faceSpan() const {
+    return faces;
+}
+
 }  // namespace OneCut
@@ -0,0 +1,138 @@
+#include "OneCut/Tracer.h"
+
+#include <atomic>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <stdexcept>
+
+namespace OneCut {
+
+namespace {
+
+// The installed tracer is guarded by a mutex; the flag lets spans skip it while tracing is off.
+std::mutex installMutex;
+std::shared_ptr<Tracer> installedTracer;
+std::atomic<bool> tracing{false};
+
+// Quotes a string as a JSON string literal.
+std::string jsonString(const std::string& text) {
+    std::ostringstream os;
+    os << '"';
+    for (char c : text) {
+        switch (c) {
+            case '"': os << "\\\""; break;
+            case '\\': os << "\\\\"; break;
+            case '\n': os << "\\n"; break;
+            case '\t': os << "\\t"; break;
+            default:
+                if (static_cast<unsigned char>(c) < 0x20) {
+                    os << "\\u" << std::hex << std::setw(4) << std::setfill('0') << static_cast<int>(c) << std::dec;
+                } else {
+                    os << c;
+                }
+        }
+    }
+    os << '"';
+    return os.str();
+}
+
+}  // namespace
+
+Tracer::Tracer() : origin(std::chrono::steady_clock::now()) {}
+
+void Tracer::install(std::shared_ptr<Tracer> tracer) {
+    std::lock_guard<std::mutex> lock(installMutex);
+    tracing.store(tracer != nullptr, std::memory_order_release);
+    installedTracer.swap(tracer);
+}
+
+std::shared_ptr<Tracer> Tracer::active() {
+    if (!tracing.load(std::memory_order_acquire)) {
+        return nullptr;
+    }
+    std::lock_guard<std::mutex> lock(installMutex);
+    return installedTracer;
+}
+
+double Tracer::nowUs() const {
+    return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - origin).count();
+}
+
+void Tracer::record(TraceEvent event) {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto [threadId, inserted] = threadIds.try_emplace(std::this_thread::get_id(), threadIds.size() + 1);
+    event.threadId = threadId->second;
+    events_.push_back(std::move(event));
+}
+
+std::vector<TraceEvent> Tracer::events() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return events_;
+}
+
+void Tracer::clear() {
+    std::lock_guard<std::mutex> lock(mutex);
+    events_.clear();
+}
+
+void Tracer::write(std::ostream& os) const {
+    std::lock_guard<std::mutex> lock(mutex);
+    std::ios_base::fmtflags flags = os.flags();
+    os << std::fixed << std::setprecision(3);
+
+    os << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+    os << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"tid\":0,\"args\":{\"name\":\"OneCut\"}}";
+    for (const auto& [thread, threadId] : threadIds) {
+        os << ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << threadId
+           << ",\"args\":{\"name\":\"thread " << threadId << "\"}}";
+    }
+    for (const TraceEvent& event : events_) {
+        os << ",\n{\"name\":" << jsonString(event.name) << ",\"cat\":" << jsonString(event.category)
+           << ",\"ph\":\"X\",\"ts\":" << event.startUs << ",\"dur\":" << event.durationUs
+           << ",\"pid\":1,\"tid\":" << event.threadId;
+        if (!event.args.empty()) {
+            os << ",\"args\":{";
+            for (size_t i = 0; i < event.args.size(); i++) {
+                os << (i ? "," : "") << jsonString(event.args[i].first) << ':' << event.args[i].second;
+            }
+            os << '}';
+        }
+        os << '}';
+    }
+    os << "\n]}\n";
+    os.flags(flags);
+}
+
+void Tracer::writeFile(const std::string& path) const {
+    std::ofstream file(path);
+    if (!file) {
+        throw std::runtime_error("Cannot open " + path);
+    }
+    write(file);
+    if (!file) {
+        throw std::runtime_error("Cannot write " + path);
+    }
+}
+
+void TraceSpan::arg(const char* key, const std::string& value) {
+    if (tracer) {
+        args.emplace_back(key, jsonString(value));
+    }
+}
+
+void TraceSpan::finish() {
+    if (!tracer) {
+        return;
+    }
+    TraceEvent event;
+    event.name = name;
+    event.category = category;
+    event.startUs = startUs;
+    event.durationUs = tracer->nowUs() - startUs;
+    event.args = std::move(args);
+    tracer->record(std::move(event));
+    tracer.reset();
+}
+
+}  // namespace OneCut
@@ -0,0 +1,87 @@
+#include "OneCut/utils/WeldGrid.h"
+
+#include <cmath>
+#include <functional>
+#include <limits>
+
+namespace OneCut {
+
+namespace {
+
+size_t combineHashes(size_t hx, size_t hy) {
+    return hx ^ (hy + 0x9e3779b97f4a7c15ULL + (hx << 6) + (hx >> 2));
+}
+
+}  // namespace
+
+size_t WeldGrid::CellHash::operator()(const std::pair<long long, long long>& cell) const {
+    return combineHashes(std::hash<long long>()(cell.first), std::hash<long long>()(cell.second));
+}
+
+size_t WeldGrid::CoordinateHash::operator()(const std::pair<double, double>& coordinates) const {
+    return combineHashes(std::hash<double>()(coordinates.first), std::hash<double>()(coordinates.second));
+}
+
+WeldGrid::WeldGrid(double tolerance) : tolerance(tolerance) {}
+
+std::pair<int, bool> WeldGrid::insert(double x, double y) {
+    int index = static_cast<int>(size());
+    if (tolerance <= 0) {
+        auto [vertex, inserted] = exactVertices.try_emplace({canonicalZero(x), canonicalZero(y)}, index);
+        if (inserted) {
+            coordinates.push_back(x);
+            coordinates.push_back(y);
+        }
+        return {vertex->second, inserted};
+    }
+
+    // Points within the tolerance lie at most one cell away
+    long long cellX = static_cast<long long>(std::floor(x / tolerance));
+    long long cellY = static_cast<long long>(std::floor(y / tolerance));
+    int nearest = -1;
+    double nearestDistance = std::numeric_limits<double>::infinity();
+    for (long long dx = -1; dx <= 1; dx++) {
+        for (long long dy = -1; dy <= 1; dy++) {
+            auto head = cellHeads.find({cellX + dx, cellY + dy});
+            if (head == cellHeads.end()) {
+                continue;
+            }
+            for (int vertex = head->second; vertex >= 0; vertex = nextInCell[vertex]) {
+                double distance = std::hypot(coordinates[2 * vertex] - x, coordinates[2 * vertex + 1] - y);
+                if (distance <= tolerance && distance < nearestDistance) {
+                    nearest = vertex;
+                    nearestDistance = distance;
+                }
+            }
+        }
+    }
+    if (nearest >= 0) {
+        return {nearest, false};
+    }
+
+    auto [head, inserted] = cellHeads.try_emplace({cellX, cellY}, index);
+    nextInCell.push_back(inserted ? -1 : head->second);
+    head->second = index;
+    coordinates.push_back(x);
+    coordinates.push_back(y);
+    return {index, true};
+}
+
+void WeldGrid::reserve(size_t vertexCount) {
+    coordinates.reserve(2 * vertexCount);
+    if (tolerance > 0) {
+        nextInCell.reserve(vertexCount);
+        cellHeads.reserve(vertexCount);
+    } else {
+        exactVertices.reserve(vertexCount);
+    }
+}
+
+void WeldGrid::clear() {
+    coordinates.clear();
+    nextInCell.clear();
+    cellHeads.clear();
+    exactVertices.clear();
+}
+
+}  // namespace OneCut
@@ -0,0 +1,42 @@
+#include <gtest/gtest.h>
+
+#include <list>
+
+#include "OneCut/Arena.h"
+
+namespace OneCut {
+
+TEST(ArenaTest, ScopeSelectsTheResourceOfNewAllocators) {
+    Arena arena;
+    EXPECT_EQ(ArenaScope::current(), std::pmr::new_delete_resource());
+    {
+        ArenaScope scope(&arena);
+        EXPECT_EQ(ArenaScope::current(), &arena);
+        {
+            ArenaScope inner(std::pmr::new_delete_resource());
+            EXPECT_EQ(ArenaScope::current(), std::pmr::new_delete_resource());
+        }
+        EXPECT_EQ(ArenaScope::current(), &arena);
+    }
+    EXPECT_EQ(ArenaScope::current(), std::pmr::new_delete_resource());
+}
+
+TEST(ArenaTest, ContainerKeepsItsArenaAfterTheScope) {
+    Arena arena;
+    std::list<int, ArenaAllocator<int>> values = [&] {
+        ArenaScope scope(&arena);
+        return std::list<int, ArenaAllocator<int>>();
+    }();
+    EXPECT_EQ(values.get_allocator().memoryResource(), &arena);
+
+    for (int i = 0; i < 100; i++) {
+        values.push_back(i);
+    }
+    EXPECT_GE(arena.bytesAllocated(), 100 * sizeof(int));
+    EXPECT_EQ(values.back(), 99);
+
+    ArenaAllocator<double> rebound(values.get_allocator());
+    EXPECT_TRUE(rebound == values.get_allocator());
+}
+
+}  // namespace OneCut
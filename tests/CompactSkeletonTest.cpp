@@ -0,0 +1,109 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include "OneCut/CompactSkeleton.h"
+#include "OneCut/PerpendicularFinder.h"
+#include "OneCut/SkeletonBuilder.h"
+#include "OneCut/StraightSkeleton.h"
+
+namespace OneCut {
+
+class CompactSkeletonTest : public ::testing::Test {
+   protected:
+    std::vector<SkeletonConstruction::Point> concave;
+
+    void SetUp() override {
+        concave = {SkeletonConstruction::Point(100, 100), SkeletonConstruction::Point(500, 100),
+                   SkeletonConstruction::Point(500, 500), SkeletonConstruction::Point(300, 300),
+                   SkeletonConstruction::Point(100, 500)};
+    }
+};
+
+TEST_F(CompactSkeletonTest, MatchesStraightSkeleton) {
+    SkeletonConstruction::SkeletonBuilder builder(concave);
+    StraightSkeleton skeleton = builder.buildSkeleton();
+    CompactSkeleton compact = builder.buildCompactSkeleton();
+
+    ASSERT_EQ(compact.faceCount(), skeleton.faceCount());
+    for (size_t i = 0; i < skeleton.faceCount(); i++) {
+        const SkeletonFace& face = skeleton.face(i);
+        const CompactFace& compactFace = compact.face(i);
+        ASSERT_EQ(compactFace.vertexCount(), face.vertexCount());
+        EXPECT_EQ(compactFace.isOuter(), face.isOuter);
+        EXPECT_EQ(compactFace.getAdjacentFaces(), face.adjacentFaces);
+        for (size_t v = 0; v < face.vertexCount(); v++) {
+            EXPECT_EQ(compactFace.vertex(v), face.vertex(v));
+        }
+    }
+}
+
+TEST_F(CompactSkeletonTest, ViewsSurviveCopyAndMove) {
+    SkeletonConstruction::SkeletonBuilder builder(concave);
+    CompactSkeleton original = builder.buildCompactSkeleton();
+    CompactSkeleton copy = original;
+    CompactSkeleton moved = std::move(copy);
+
+    ASSERT_EQ(moved.faceCount(), original.faceCount());
+    for (size_t i = 0; i < original.faceCount(); i++) {
+        EXPECT_EQ(moved.face(i).getVertices(), original.face(i).getVertices());
+    }
+}
+
+TEST_F(CompactSkeletonTest, ConstructionApi) {
+    CompactSkeleton compact;
+    compact.addVertex(0, 0, -1);
+    compact.addVertex(1, 0, 1);
+    compact.addVertex(0, 1, -1);
+    compact.closeFace(false);
+    compact.addVertex(1, 0, -1);
+    compact.addVertex(1, 1, -1);
+    compact.addVertex(0, 1, 0);
+    compact.closeFace(true);
+    compact.setAdjacentFaceIndex(1, 0, 2);
+
+    EXPECT_EQ(compact.faceCount(), 2);
+    EXPECT_EQ(compact.vertexCount(), 6);
+    EXPECT_EQ(compact.getFaceOffsets(), std::vector<int>({0, 3, 6}));
+    EXPECT_FALSE(compact.face(0).isOuter());
+    EXPECT_TRUE(compact.face(1).isOuter());
+    EXPECT_EQ(compact.face(1).adjacentFaceIndex(0), 2);
+    EXPECT_DOUBLE_EQ(compact.face(1).x(1), 1.0);
+    EXPECT_DOUBLE_EQ(compact.face(1).y(1), 1.0);
+}
+
+TEST_F(CompactSkeletonTest, SpansMatchCopies) {
+    SkeletonConstruction::SkeletonBuilder builder(concave);
+    StraightSkeleton skeleton = builder.buildSkeleton();
+    CompactSkeleton compact = builder.buildCompactSkeleton();
+
+    std::span<const SkeletonFace> faces = skeleton.faceSpan();
+    ASSERT_EQ(faces.size(), skeleton.faceCount());
+    for (size_t i = 0; i < faces.size(); i++) {
+        EXPECT_EQ(&faces[i], &skeleton.face(i));
+        std::span<const int> adjacentFaces = faces[i].adjacentFaceSpan();
+        EXPECT_EQ(std::vector<int>(adjacentFaces.begin(), adjacentFaces.end()), faces[i].getAdjacentFaces());
+        std::span<const Point> vertices = faces[i].vertexSpan();
+        EXPECT_EQ(std::vector<Point>(vertices.begin(), vertices.end()), faces[i].getVertices());
+
+        std::span<const int> compactAdjacentFaces = compact.face(i).adjacentFaceSpan();
+        EXPECT_TRUE(std::equal(compactAdjacentFaces.begin(), compactAdjacentFaces.end(), adjacentFaces.begin(),
+                               adjacentFaces.end()));
+        EXPECT_EQ(compact.face(i).coordinateSpan().size(), 2 * vertices.size());
+    }
+}
+
+TEST_F(CompactSkeletonTest, FinderGivesSameChains) {
+    SkeletonConstruction::SkeletonBuilder builder(concave);
+    StraightSkeleton skeleton = builder.buildSkeleton();
+    CompactSkeleton compact = builder.buildCompactSkeleton();
+
+    PerpendicularFinder finder(skeleton);
+    PerpendicularFinder compactFinder(compact);
+    EXPECT_EQ(compactFinder.findPerpendiculars().size(), finder.findPerpendiculars().size());
+}
+
+}  // namespace OneCut
@@ -0,0 +1,82 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <filesystem>
+#include <vector>
+
+#include "OneCut/CreaseCache.h"
+#include "OneCut/utils/PolygonGenerator.h"
+
+namespace OneCut {
+
+class CreaseCacheTest : public ::testing::Test {
+   protected:
+    std::vector<SkeletonConstruction::Point> polygon = PolygonGenerator::generate("star", 12);
+    std::vector<SkeletonConstruction::Point> otherPolygon = PolygonGenerator::generate("convex", 8);
+};
+
+TEST_F(CreaseCacheTest, HashIgnoresStartVertexAndOrientation) {
+    std::vector<SkeletonConstruction::Point> rotated = polygon;
+    std::rotate(rotated.begin(), rotated.begin() + 5, rotated.end());
+    std::vector<SkeletonConstruction::Point> reversed(polygon.rbegin(), polygon.rend());
+
+    EXPECT_EQ(CreaseCache::polygonHash(rotated), CreaseCache::polygonHash(polygon));
+    EXPECT_EQ(CreaseCache::polygonHash(reversed), CreaseCache::polygonHash(polygon));
+    EXPECT_NE(CreaseCache::polygonHash(otherPolygon), CreaseCache::polygonHash(polygon));
+
+    FoldOptions interiorOnly;
+    interiorOnly.interiorOnly = true;
+    EXPECT_NE(CreaseCache::polygonHash(polygon, interiorOnly), CreaseCache::polygonHash(polygon));
+}
+
+TEST_F(CreaseCacheTest, HitReturnsStoredCreases) {
+    CreaseCache cache(4);
+    std::vector<Crease> computed = cache.getCreases(polygon);
+    std::vector<SkeletonConstruction::Point> rotated = polygon;
+    std::rotate(rotated.begin(), rotated.begin() + 3, rotated.end());
+    std::vector<Crease> cached = cache.getCreases(rotated);
+
+    ASSERT_EQ(cached.size(), computed.size());
+    for (size_t i = 0; i < computed.size(); i++) {
+        EXPECT_EQ(cached[i].edge, computed[i].edge);
+        EXPECT_EQ(cached[i].foldType, computed[i].foldType);
+    }
+    CacheStats stats = cache.getStats();
+    EXPECT_EQ(stats.misses, 1);
+    EXPECT_EQ(stats.hits, 1);
+}
+
+TEST_F(CreaseCacheTest, EvictsLeastRecentlyUsed) {
+    CreaseCache cache(1);
+    cache.getCreases(polygon);
+    cache.getCreases(otherPolygon);
+    cache.getCreases(polygon);
+
+    CacheStats stats = cache.getStats();
+    EXPECT_EQ(cache.size(), 1);
+    EXPECT_EQ(stats.misses, 3);
+    EXPECT_EQ(stats.evictions, 2);
+}
+
+TEST_F(CreaseCacheTest, DiskTierSurvivesNewCache) {
+    std::filesystem::path directory = std::filesystem::temp_directory_path() / "onecut_crease_cache_test";
+    std::filesystem::remove_all(directory);
+
+    std::vector<Crease> computed = CreaseCache(4, directory.string()).getCreases(polygon);
+
+    CreaseCache cache(4, directory.string());
+    std::vector<Crease> loaded = cache.getCreases(polygon);
+    ASSERT_EQ(loaded.size(), computed.size());
+    for (size_t i = 0; i < computed.size(); i++) {
+        EXPECT_EQ(loaded[i].edge, computed[i].edge);
+        EXPECT_EQ(loaded[i].foldType, computed[i].foldType);
+        EXPECT_EQ(loaded[i].origin, computed[i].origin);
+        EXPECT_EQ(loaded[i].faceIndex, computed[i].faceIndex);
+    }
+    EXPECT_EQ(cache.getStats().diskHits, 1);
+    EXPECT_EQ(cache.getStats().misses, 0);
+
+    std::filesystem::remove_all(directory);
+}
+
+}  // namespace OneCut
@@ -0,0 +1,54 @@
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "OneCut/CreasePattern.h"
+#include "OneCut/FoldManager.h"
+#include "OneCut/utils/PolygonGenerator.h"
+
+namespace OneCut {
+
+TEST(CreasePatternTest, WeldsSharedEndPoints) {
+    CreasePatternBuilder builder(1e-9);
+    int a = builder.addVertex(0, 0);
+    int b = builder.addVertex(2, 2);
+    EXPECT_EQ(builder.addVertex(2, 2 + 1e-12), b);
+    EXPECT_EQ(builder.addVertex(-0.0, 0.0), a);
+    EXPECT_TRUE(builder.addCrease(a, b, FoldType::MOUNTAIN, Origin::SKELETON, 3));
+    EXPECT_FALSE(builder.addCrease(b, b, FoldType::VALLEY, Origin::PERPENDICULAR));
+
+    CreasePattern pattern = builder.build();
+    EXPECT_EQ(pattern.vertexCount(), 2);
+    ASSERT_EQ(pattern.creaseCount(), 1);
+    EXPECT_EQ(pattern.edgeVertices, std::vector<int>({a, b}));
+    EXPECT_EQ(pattern.faceIndices[0], 3);
+    EXPECT_EQ(builder.build().vertexCount(), 0);
+}
+
+TEST(CreasePatternTest, WeldsAcrossCellBorders) {
+    CreasePatternBuilder builder(1e-3);
+    int a = builder.addVertex(1.0004, 0);
+    EXPECT_EQ(builder.addVertex(1.0006, 0), a);
+    EXPECT_EQ(builder.addVertex(0.9996, 0), a);
+    EXPECT_NE(builder.addVertex(1.0016, 0), a);
+    EXPECT_EQ(builder.build().vertexCoordinates, std::vector<double>({1.0004, 0, 1.0016, 0}));
+}
+
+TEST(CreasePatternTest, FoldManagerPatternMatchesCreases) {
+    for (const std::string& family : PolygonGenerator::families()) {
+        std::vector<SkeletonConstruction::Point> polygon = PolygonGenerator::generate(family, 30);
+        CreasePattern expected = CreasePatternBuilder::fromCreases(FoldManager(polygon).getCreases());
+        CreasePattern pattern = FoldManager(polygon).getCreasePattern();
+
+        EXPECT_EQ(pattern.vertexCoordinates, expected.vertexCoordinates) << family;
+        EXPECT_EQ(pattern.edgeVertices, expected.edgeVertices) << family;
+        EXPECT_EQ(pattern.foldTypes, expected.foldTypes) << family;
+        EXPECT_EQ(pattern.origins, expected.origins) << family;
+        EXPECT_EQ(pattern.faceIndices, expected.faceIndices) << family;
+
+        // Skeleton creases meet in shared vertices, so welding stores fewer than two per crease
+        EXPECT_LT(pattern.vertexCount(), 2 * pattern.creaseCount()) << family;
+    }
+}
+
+}  // namespace OneCut
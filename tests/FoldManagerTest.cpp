@@ -0,0 +1,65 @@
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "OneCut/FoldManager.h"
+#include "OneCut/utils/PolygonGenerator.h"
+
+namespace OneCut {
+
+TEST(FoldManagerTest, BatchMatchesSingleComputation) {
+    std::vector<std::vector<SkeletonConstruction::Point>> polygons;
+    for (const std::string& family : PolygonGenerator::families()) {
+        polygons.push_back(PolygonGenerator::generate(family, 30));
+    }
+
+    std::vector<FoldResult> results = FoldManager::computeBatch(polygons, FoldOptions(), 4);
+    ASSERT_EQ(results.size(), polygons.size());
+    for (size_t i = 0; i < polygons.size(); i++) {
+        ASSERT_TRUE(results[i].ok()) << results[i].error;
+        std::vector<Crease> expected = FoldManager(polygons[i]).getCreases();
+        ASSERT_EQ(results[i].creases.size(), expected.size());
+        for (size_t c = 0; c < expected.size(); c++) {
+            EXPECT_EQ(results[i].creases[c].edge, expected[c].edge);
+            EXPECT_EQ(results[i].creases[c].foldType, expected[c].foldType);
+        }
+        EXPECT_EQ(results[i].stats.creaseCount, expected.size());
+    }
+}
+
+TEST(FoldManagerTest, BatchIsolatesFailures) {
+    std::vector<std::vector<SkeletonConstruction::Point>> polygons = {
+        PolygonGenerator::generate("convex", 10),
+        {SkeletonConstruction::Point(0, 0), SkeletonConstruction::Point(1, 1)},
+        PolygonGenerator::generate("star", 10)};
+
+    std::vector<FoldResult> results = FoldManager::computeBatch(polygons, FoldOptions(), 2);
+    ASSERT_EQ(results.size(), 3);
+    EXPECT_TRUE(results[0].ok());
+    EXPECT_FALSE(results[0].creases.empty());
+    EXPECT_FALSE(results[1].ok());
+    EXPECT_TRUE(results[1].creases.empty());
+    EXPECT_TRUE(results[2].ok());
+    EXPECT_FALSE(results[2].creases.empty());
+}
+
+TEST(FoldManagerTest, EmptyBatch) {
+    EXPECT_TRUE(FoldManager::computeBatch({}).empty());
+}
+
+TEST(FoldManagerTest, OnlyExplicitPaperRejectsPolygonsOffIt) {
+    std::vector<SkeletonConstruction::Point> farSquare = {
+        SkeletonConstruction::Point(900, 100), SkeletonConstruction::Point(1300, 100),
+        SkeletonConstruction::Point(1300, 500), SkeletonConstruction::Point(900, 500)};
+    EXPECT_NO_THROW(FoldManager(farSquare).getCreases());
+
+    FoldOptions options;
+    options.paper = Paper();
+    EXPECT_THROW(FoldManager(farSquare, options), std::invalid_argument);
+    options.paper = Paper::unbounded();
+    EXPECT_NO_THROW(FoldManager(farSquare, options).getCreases());
+}
+
+}  // namespace OneCut
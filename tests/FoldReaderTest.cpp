@@ -0,0 +1,52 @@
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "FoldTestUtil.h"
+#include "OneCut/FoldManager.h"
+#include "OneCut/FoldReader.h"
+
+namespace OneCut {
+
+class FoldReaderTest : public FoldFileTest {};
+
+TEST_F(FoldReaderTest, ReadsWrittenFile) {
+    FoldData data = FoldReader::parse(writeFold(square, FoldManager(square).getCreases()));
+    ASSERT_GE(data.vertexCount(), square.size());
+    EXPECT_EQ(data.edgeVertices.size(), 2 * data.edgeAssignments.size());
+    EXPECT_EQ(data.edgeAssignments.substr(0, 4), "BBBB");
+    ASSERT_EQ(data.faces.size(), 1u);
+    EXPECT_EQ(data.faces[0], std::vector<int>({0, 1, 2, 3}));
+
+    std::vector<std::vector<SkeletonConstruction::Point>> polygons = data.boundaryPolygons();
+    ASSERT_EQ(polygons.size(), 1u);
+    EXPECT_EQ(polygons[0], square);
+}
+
+TEST_F(FoldReaderTest, SkipsUnknownKeysAndDropsZ) {
+    FoldData data = FoldReader::parse(
+        "{\"file_spec\": 1.1, \"frame_attributes\": [\"3D\"], \"meta\": {\"a\": [1, {\"b\": \"]}\"}], \"c\": null},"
+        " \"vertices_coords\": [[0, 0, 1], [2, 0, 1], [1, 1e0, 1]],"
+        " \"edges_vertices\": [[0, 1], [1, 2], [2, 0]], \"edges_assignment\": [\"B\", \"B\", \"B\"]}");
+    EXPECT_EQ(data.vertexCoordinates, std::vector<double>({0, 0, 2, 0, 1, 1}));
+    ASSERT_EQ(data.boundaryPolygons().size(), 1u);
+    EXPECT_EQ(data.boundaryPolygons()[0].size(), 3u);
+}
+
+TEST_F(FoldReaderTest, FallsBackToFaces) {
+    FoldData data =
+        FoldReader::parse("{\"vertices_coords\": [[0, 0], [2, 0], [1, 1]], \"faces_vertices\": [[0, 1, 2]]}");
+    ASSERT_EQ(data.boundaryPolygons().size(), 1u);
+    EXPECT_EQ(data.boundaryPolygons()[0][2], SkeletonConstruction::Point(1, 1));
+}
+
+TEST_F(FoldReaderTest, RejectsMalformedInput) {
+    EXPECT_THROW(FoldReader::parse("{\"vertices_coords\": [[0, 0], [1]]}"), std::runtime_error);
+    EXPECT_THROW(FoldReader::parse("{\"edges_vertices\": [[0, 1]"), std::runtime_error);
+    EXPECT_THROW(FoldReader::parse("[]"), std::runtime_error);
+    EXPECT_THROW(FoldReader::read("/nonexistent/file.fold"), std::runtime_error);
+}
+
+}  // namespace OneCut
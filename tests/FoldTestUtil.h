@@ -0,0 +1,38 @@
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "OneCut/Crease.h"
+#include "OneCut/FoldWriter.h"
+#include "OneCut/SkeletonBuilder.h"
+
+namespace OneCut {
+
+/**
+ * @class FoldFileTest
+ * @brief Fixture shared by the FOLD reader and writer tests.
+ */
+class FoldFileTest : public ::testing::Test {
+   protected:
+    /// 4 x 4 square with its lower left corner at the origin
+    std::vector<SkeletonConstruction::Point> square = {
+        SkeletonConstruction::Point(0, 0), SkeletonConstruction::Point(4, 0), SkeletonConstruction::Point(4, 4),
+        SkeletonConstruction::Point(0, 4)};
+
+    /**
+     * @brief Writes creases as a FOLD file with the default writer.
+     * @return The JSON text
+     */
+    static std::string writeFold(const std::vector<SkeletonConstruction::Point>& polygon,
+                                 const std::vector<Crease>& creases) {
+        std::ostringstream os;
+        FoldWriter().write(os, polygon, creases);
+        return os.str();
+    }
+};
+
+}  // namespace OneCut
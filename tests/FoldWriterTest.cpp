@@ -0,0 +1,59 @@
+#include <gtest/gtest.h>
+
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "FoldTestUtil.h"
+#include "OneCut/FoldManager.h"
+#include "OneCut/FoldWriter.h"
+
+namespace OneCut {
+
+namespace {
+
+Crease makeCrease(double x1, double y1, double x2, double y2, FoldType foldType) {
+    Crease crease;
+    crease.edge = std::make_pair(Point(x1, y1), Point(x2, y2));
+    crease.foldType = foldType;
+    crease.origin = Origin::SKELETON;
+    return crease;
+}
+
+}  // namespace
+
+class FoldWriterTest : public FoldFileTest {};
+
+TEST_F(FoldWriterTest, WeldsSharedEndPoints) {
+    std::vector<Crease> creases = {makeCrease(0, 0, 2, 2, FoldType::MOUNTAIN),
+                                   makeCrease(2, 2, 4, 4, FoldType::MOUNTAIN),
+                                   makeCrease(2, 2 + 1e-12, 4, 0, FoldType::VALLEY),
+                                   makeCrease(1, 1, 1, 1, FoldType::VALLEY)};
+    std::string json = writeFold(square, creases);
+
+    EXPECT_NE(json.find("\"vertices_coords\": [[0, 0], [4, 0], [4, 4], [0, 4], [2, 2]]"), std::string::npos);
+    EXPECT_NE(json.find("\"faces_vertices\": [[0, 1, 2, 3]]"), std::string::npos);
+    EXPECT_NE(json.find("\"edges_vertices\": [[0, 1], [1, 2], [2, 3], [3, 0], [0, 4], [4, 2], [4, 1]]"),
+              std::string::npos);
+    EXPECT_NE(json.find("\"edges_assignment\": [\"B\", \"B\", \"B\", \"B\", \"M\", \"M\", \"V\"]"), std::string::npos);
+}
+
+TEST_F(FoldWriterTest, ArraysMatchCreases) {
+    std::vector<Crease> creases = FoldManager(square).getCreases();
+    std::vector<double> segments;
+    std::vector<std::int8_t> foldTypes;
+    for (const Crease& crease : creases) {
+        segments.insert(segments.end(), {CGAL::to_double(crease.edge.first.x()), CGAL::to_double(crease.edge.first.y()),
+                                         CGAL::to_double(crease.edge.second.x()),
+                                         CGAL::to_double(crease.edge.second.y())});
+        foldTypes.push_back(static_cast<std::int8_t>(crease.foldType));
+    }
+
+    std::ostringstream fromArrays;
+    FoldWriter().write(fromArrays, square, segments, foldTypes);
+    EXPECT_EQ(fromArrays.str(), writeFold(square, creases));
+    EXPECT_THROW(FoldWriter().write(fromArrays, square, segments, std::span<const std::int8_t>()),
+                 std::invalid_argument);
+}
+
+}  // namespace OneCut
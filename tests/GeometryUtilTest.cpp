@@ -121,5 +121,13 @@ TEST(GeometryUtilTest, ScalarProjectionPrecision) {
     EXPECT_NEAR(CGAL::to_double(result), expected, 1e-6);
 }
 
+TEST(GeometryUtilTest, FastKernelMatchesExactKernel) {
+    FastGeometryUtil::Vector a(2, 3);
+    FastGeometryUtil::Vector b(1, 1);
+    FastGeometryUtil::Vector normalized = FastGeometryUtil::normalize(b);
+    EXPECT_NEAR(normalized.x(), 1.0 / std::sqrt(2.0), 1e-12);
+    EXPECT_DOUBLE_EQ(FastGeometryUtil::cross(a, b), CGAL::to_double(GeometryUtil::cross(Vector(2, 3), Vector(1, 1))));
+    EXPECT_NEAR(FastGeometryUtil::scalarProjection(a, b), 5.0 / std::sqrt(2.0), 1e-12);
+}
 
-}
\ No newline at end of file
+}
@@ -86,4 +86,18 @@ TEST(IntersectionUtilTest, VerticalRayHorizontalSegment) {
     EXPECT_DOUBLE_EQ(result.segmentParam, 0.5);
 }
 
+TEST(IntersectionUtilTest, RayEdgeMatchesRaySegment) {
+    FastIntersectionUtil::Point origin(0.5, -2);
+    FastIntersectionUtil::Vector direction(0.25, 1);
+    FastIntersectionUtil::Point segStart(-1, 1);
+    FastIntersectionUtil::Point segEnd(4, 2);
+
+    auto segmentResult = FastIntersectionUtil::intersectRaySegment(origin, direction, segStart, segEnd);
+    auto edgeResult = FastIntersectionUtil::intersectRayEdge(origin, direction, segStart, segEnd - segStart);
+
+    EXPECT_TRUE(edgeResult.valid);
+    EXPECT_DOUBLE_EQ(edgeResult.rayParam, segmentResult.rayParam);
+    EXPECT_DOUBLE_EQ(edgeResult.segmentParam, segmentResult.segmentParam);
+}
+
 }  // namespace OneCut
\ No newline at end of file
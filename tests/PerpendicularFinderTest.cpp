@@ -1,11 +1,15 @@
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <set>
+#include <string>
 #include <vector>
 
 #include "OneCut/PerpendicularFinder.h"
 #include "OneCut/SkeletonBuilder.h"
 #include "OneCut/SkeletonFace.h"
 #include "OneCut/StraightSkeleton.h"
+#include "OneCut/utils/PolygonGenerator.h"
 
 namespace OneCut {
 
@@ -22,4 +26,291 @@ TEST(PerpendicularFinderTest, BasicTest) {
     EXPECT_GE(chains.size(), 1);
 }
 
+TEST(PerpendicularFinderTest, FastKernelMatchesExactKernel) {
+    std::vector<SkeletonConstruction::Point> concave = {
+        SkeletonConstruction::Point(100, 100), SkeletonConstruction::Point(500, 100),
+        SkeletonConstruction::Point(500, 500), SkeletonConstruction::Point(300, 300),
+        SkeletonConstruction::Point(100, 500)};
+
+    SkeletonConstruction::SkeletonBuilder builder(concave);
+    auto skeleton = builder.buildSkeleton();
+
+    std::vector<PerpChain> exactChains = PerpendicularFinder(skeleton).findPerpendiculars();
+    std::vector<BasicPerpChain<FastKernel>> fastChains = FastPerpendicularFinder(skeleton).findPerpendiculars();
+    ASSERT_EQ(fastChains.size(), exactChains.size());
+    for (size_t c = 0; c < exactChains.size(); c++) {
+        ASSERT_EQ(fastChains[c].size(), exactChains[c].size());
+        for (size_t s = 0; s < exactChains[c].size(); s++) {
+            EXPECT_EQ(fastChains[c][s].faceIndex, exactChains[c][s].faceIndex);
+            EXPECT_NEAR(fastChains[c][s].end.x(), CGAL::to_double(exactChains[c][s].end.x()), 1e-9);
+            EXPECT_NEAR(fastChains[c][s].end.y(), CGAL::to_double(exactChains[c][s].end.y()), 1e-9);
+        }
+    }
+}
+
+TEST(PerpendicularFinderTest, ParallelMatchesSerial) {
+    std::vector<SkeletonConstruction::Point> polygon = PolygonGenerator::generate("comb", 200);
+
+    SkeletonConstruction::SkeletonBuilder builder(polygon);
+    auto skeleton = builder.buildSkeleton();
+
+    FastPerpendicularFinder serialFinder(skeleton);
+    PipelineStats serialStats;
+    std::vector<BasicPerpChain<FastKernel>> serialChains = serialFinder.findPerpendiculars(serialStats);
+
+    for (int threadCount : {2, 4, 0}) {
+        FastPerpendicularFinder parallelFinder(skeleton);
+        parallelFinder.setThreadCount(threadCount);
+        PipelineStats parallelStats;
+        std::vector<BasicPerpChain<FastKernel>> parallelChains = parallelFinder.findPerpendiculars(parallelStats);
+
+        ASSERT_EQ(parallelChains.size(), serialChains.size());
+        for (size_t c = 0; c < serialChains.size(); c++) {
+            ASSERT_EQ(parallelChains[c].size(), serialChains[c].size());
+            for (size_t s = 0; s < serialChains[c].size(); s++) {
+                EXPECT_EQ(parallelChains[c][s].start, serialChains[c][s].start);
+                EXPECT_EQ(parallelChains[c][s].end, serialChains[c][s].end);
+                EXPECT_EQ(parallelChains[c][s].faceIndex, serialChains[c][s].faceIndex);
+            }
+        }
+        EXPECT_EQ(parallelStats.chainIterations, serialStats.chainIterations);
+        EXPECT_EQ(parallelStats.invalidHits, serialStats.invalidHits);
+    }
+}
+
+TEST(PerpendicularFinderTest, GraphHasNoDuplicates) {
+    std::vector<SkeletonConstruction::Point> polygon = PolygonGenerator::generate("comb", 200);
+
+    SkeletonConstruction::SkeletonBuilder builder(polygon);
+    auto skeleton = builder.buildSkeleton();
+
+    BasicPerpGraph<FastKernel> graph = FastPerpendicularFinder(skeleton).findPerpendicularGraph();
+    ASSERT_FALSE(graph.segments.empty());
+
+    std::set<std::pair<int, int>> segments;
+    for (const PerpGraphSegment& segment : graph.segments) {
+        ASSERT_NE(segment.start, segment.end);
+        auto key = std::make_pair(std::min(segment.start, segment.end), std::max(segment.start, segment.end));
+        EXPECT_TRUE(segments.insert(key).second);
+    }
+    std::set<std::pair<double, double>> vertices;
+    for (const auto& vertex : graph.vertices) {
+        EXPECT_TRUE(vertices.emplace(vertex.x(), vertex.y()).second);
+    }
+}
+
+TEST(PerpendicularFinderTest, GraphVerticesAreSegmentEnds) {
+    for (const std::string& family : PolygonGenerator::families()) {
+        std::vector<SkeletonConstruction::Point> polygon = PolygonGenerator::generate(family, 100);
+        SkeletonConstruction::SkeletonBuilder builder(polygon);
+        auto skeleton = builder.buildSkeleton();
+
+        for (int chainBudget : {FastPerpendicularFinder::MAX_ITERATIONS, 1}) {
+            FastPerpendicularFinder finder(skeleton);
+            finder.setChainBudget(chainBudget);
+            BasicPerpGraph<FastKernel> graph = finder.findPerpendicularGraph();
+
+            std::vector<bool> referenced(graph.vertices.size(), false);
+            for (const PerpGraphSegment& segment : graph.segments) {
+                ASSERT_LT(static_cast<size_t>(segment.start), graph.vertices.size()) << family;
+                ASSERT_LT(static_cast<size_t>(segment.end), graph.vertices.size()) << family;
+                referenced[segment.start] = referenced[segment.end] = true;
+            }
+            EXPECT_EQ(std::count(referenced.begin(), referenced.end(), false), 0)
+                << family << ", chain budget " << chainBudget;
+        }
+    }
+}
+
+TEST(PerpendicularFinderTest, GraphIsUnionOfChains) {
+    std::vector<SkeletonConstruction::Point> polygon = PolygonGenerator::generate("comb", 200);
+
+    SkeletonConstruction::SkeletonBuilder builder(polygon);
+    auto skeleton = builder.buildSkeleton();
+
+    // Small budgets cut chains short, so later chains have to continue what earlier ones left
+    for (int chainBudget : {FastPerpendicularFinder::MAX_ITERATIONS, 3, 1, 0}) {
+        for (int threadCount : {1, 4}) {
+            FastPerpendicularFinder finder(skeleton);
+            finder.setChainBudget(chainBudget);
+            finder.setThreadCount(threadCount);
+            BasicPerpGraph<FastKernel> graph = finder.findPerpendicularGraph();
+
+            // Graph vertex of a chain point, found among the vertices it may have been merged with
+            auto vertexOf = [&graph](const FastKernel::Point_2& point) {
+                for (size_t v = 0; v < graph.vertices.size(); v++) {
+                    if (CGAL::squared_distance(graph.vertices[v], point) <=
+                        FastPerpendicularFinder::VERTEX_SNAP * FastPerpendicularFinder::VERTEX_SNAP) {
+                        return static_cast<int>(v);
+                    }
+                }
+                return -1;
+            };
+
+            std::set<std::pair<int, int>> chainSegments;
+            for (const auto& chain : finder.findPerpendiculars()) {
+                for (const auto& segment : chain) {
+                    int start = vertexOf(segment.start);
+                    int end = vertexOf(segment.end);
+                    ASSERT_GE(start, 0) << "budget " << chainBudget;
+                    ASSERT_GE(end, 0) << "budget " << chainBudget;
+                    if (start != end) {
+                        chainSegments.emplace(std::min(start, end), std::max(start, end));
+                    }
+                }
+            }
+            std::set<std::pair<int, int>> graphSegments;
+            for (const PerpGraphSegment& segment : graph.segments) {
+                graphSegments.emplace(std::min(segment.start, segment.end), std::max(segment.start, segment.end));
+            }
+            EXPECT_EQ(graphSegments, chainSegments) << "budget " << chainBudget << ", threads " << threadCount;
+        }
+    }
+}
+
+TEST(PerpendicularFinderTest, ParallelGraphMatchesSerial) {
+    std::vector<SkeletonConstruction::Point> polygon = PolygonGenerator::generate("comb", 200);
+
+    SkeletonConstruction::SkeletonBuilder builder(polygon);
+    auto skeleton = builder.buildSkeleton();
+
+    BasicPerpGraph<FastKernel> serialGraph = FastPerpendicularFinder(skeleton).findPerpendicularGraph();
+    FastPerpendicularFinder parallelFinder(skeleton);
+    parallelFinder.setThreadCount(4);
+    BasicPerpGraph<FastKernel> parallelGraph = parallelFinder.findPerpendicularGraph();
+
+    ASSERT_EQ(parallelGraph.segments.size(), serialGraph.segments.size());
+    for (size_t s = 0; s < serialGraph.segments.size(); s++) {
+        EXPECT_EQ(parallelGraph.segments[s].start, serialGraph.segments[s].start);
+        EXPECT_EQ(parallelGraph.segments[s].end, serialGraph.segments[s].end);
+        EXPECT_EQ(parallelGraph.segments[s].faceIndex, serialGraph.segments[s].faceIndex);
+    }
+    ASSERT_EQ(parallelGraph.vertices.size(), serialGraph.vertices.size());
+    for (size_t v = 0; v < serialGraph.vertices.size(); v++) {
+        EXPECT_EQ(parallelGraph.vertices[v], serialGraph.vertices[v]);
+    }
+}
+
+TEST(PerpendicularFinderTest, TerminationsMatchChains) {
+    std::vector<SkeletonConstruction::Point> polygon = PolygonGenerator::generate("comb", 200);
+
+    SkeletonConstruction::SkeletonBuilder builder(polygon);
+    auto skeleton = builder.buildSkeleton();
+
+    FastPerpendicularFinder finder(skeleton);
+    PipelineStats stats;
+    std::vector<BasicPerpChain<FastKernel>> chains = finder.findPerpendiculars(stats);
+    const std::vector<ChainTermination>& terminations = finder.getTerminations();
+    ASSERT_EQ(terminations.size(), chains.size());
+
+    auto count = [&terminations](ChainTermination reason) {
+        return static_cast<size_t>(std::count(terminations.begin(), terminations.end(), reason));
+    };
+    EXPECT_EQ(count(ChainTermination::BOUNDARY), stats.boundaryStops);
+    EXPECT_EQ(count(ChainTermination::CYCLE), stats.cycleStops);
+    EXPECT_EQ(count(ChainTermination::CHAIN_BUDGET), stats.chainBudgetStops);
+    EXPECT_EQ(count(ChainTermination::MERGED), 0);
+    EXPECT_GT(stats.boundaryStops, 0);
+    for (size_t c = 0; c < chains.size(); c++) {
+        EXPECT_LE(chains[c].size(), FastPerpendicularFinder::MAX_ITERATIONS);
+    }
+}
+
+TEST(PerpendicularFinderTest, ChainBudgetLimitsEveryChain) {
+    std::vector<SkeletonConstruction::Point> polygon = PolygonGenerator::generate("comb", 200);
+
+    SkeletonConstruction::SkeletonBuilder builder(polygon);
+    auto skeleton = builder.buildSkeleton();
+
+    FastPerpendicularFinder finder(skeleton);
+    finder.setChainBudget(2);
+    PipelineStats stats;
+    for (const auto& chain : finder.findPerpendiculars(stats)) {
+        EXPECT_LE(chain.size(), 2);
+    }
+    EXPECT_GT(stats.chainBudgetStops, 0);
+
+    // Without a chain budget, cycle detection still ends every chain
+    finder.setChainBudget(0);
+    PipelineStats unlimitedStats;
+    finder.findPerpendiculars(unlimitedStats);
+    EXPECT_EQ(unlimitedStats.chainBudgetStops, 0);
+    EXPECT_GE(unlimitedStats.chainIterations, stats.chainIterations);
+}
+
+TEST(PerpendicularFinderTest, JobBudgetLimitsTotalIterations) {
+    std::vector<SkeletonConstruction::Point> polygon = PolygonGenerator::generate("comb", 200);
+
+    SkeletonConstruction::SkeletonBuilder builder(polygon);
+    auto skeleton = builder.buildSkeleton();
+
+    for (int threadCount : {1, 4}) {
+        FastPerpendicularFinder finder(skeleton);
+        finder.setThreadCount(threadCount);
+        finder.setJobBudget(100);
+        PipelineStats stats;
+        finder.findPerpendiculars(stats);
+        EXPECT_LE(stats.chainIterations, 100);
+        EXPECT_GT(stats.jobBudgetStops, 0);
+
+        PipelineStats graphStats;
+        finder.findPerpendicularGraph(graphStats);
+        EXPECT_LE(graphStats.chainIterations, 100);
+    }
+}
+
+TEST(PerpendicularFinderTest, JobBudgetDoesNotDependOnThreadCount) {
+    std::vector<SkeletonConstruction::Point> polygon = PolygonGenerator::generate("comb", 200);
+
+    SkeletonConstruction::SkeletonBuilder builder(polygon);
+    auto skeleton = builder.buildSkeleton();
+
+    FastPerpendicularFinder serialFinder(skeleton);
+    serialFinder.setJobBudget(150);
+    PipelineStats serialStats;
+    BasicPerpGraph<FastKernel> serialGraph = serialFinder.findPerpendicularGraph(serialStats);
+    std::vector<BasicPerpChain<FastKernel>> serialChains = serialFinder.findPerpendiculars();
+
+    for (int threadCount : {2, 4, 0}) {
+        FastPerpendicularFinder finder(skeleton);
+        finder.setJobBudget(150);
+        finder.setThreadCount(threadCount);
+        PipelineStats stats;
+        BasicPerpGraph<FastKernel> graph = finder.findPerpendicularGraph(stats);
+        EXPECT_EQ(stats.jobBudgetStops, serialStats.jobBudgetStops);
+        ASSERT_EQ(graph.segments.size(), serialGraph.segments.size());
+        for (size_t s = 0; s < graph.segments.size(); s++) {
+            EXPECT_EQ(graph.segments[s].start, serialGraph.segments[s].start);
+            EXPECT_EQ(graph.segments[s].end, serialGraph.segments[s].end);
+        }
+
+        std::vector<BasicPerpChain<FastKernel>> chains = finder.findPerpendiculars();
+        ASSERT_EQ(chains.size(), serialChains.size());
+        for (size_t c = 0; c < chains.size(); c++) {
+            EXPECT_EQ(chains[c].size(), serialChains[c].size());
+        }
+    }
+}
+
+TEST(PerpendicularFinderTest, ChainsStayOnPaper) {
+    std::vector<SkeletonConstruction::Point> polygon = PolygonGenerator::generate("star", 40);
+
+    SkeletonConstruction::SkeletonBuilder builder(polygon);
+    auto skeleton = builder.buildSkeleton();
+
+    Paper paper{20, 20, 580, 580};
+    FastPerpendicularFinder finder(skeleton);
+    finder.setPaper(paper);
+    PipelineStats stats;
+    std::vector<BasicPerpChain<FastKernel>> chains = finder.findPerpendiculars(stats);
+    ASSERT_FALSE(chains.empty());
+    for (const auto& chain : chains) {
+        for (const auto& segment : chain) {
+            EXPECT_TRUE(paper.contains(segment.start.x(), segment.start.y()));
+            EXPECT_TRUE(paper.contains(segment.end.x(), segment.end.y()));
+        }
+    }
+    EXPECT_GT(stats.boundaryStops, 0);
+}
+
 }  // namespace OneCut
@@ -0,0 +1,67 @@
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+#include <vector>
+
+#include "OneCut/utils/PolygonGenerator.h"
+
+namespace OneCut {
+
+namespace {
+
+SkeletonConstruction::Polygon_2 toPolygon(const std::vector<SkeletonConstruction::Point>& points) {
+    return SkeletonConstruction::Polygon_2(points.begin(), points.end());
+}
+
+}  // namespace
+
+TEST(PolygonGeneratorTest, VertexCounts) {
+    EXPECT_EQ(PolygonGenerator::convex(10).size(), 10);
+    EXPECT_EQ(PolygonGenerator::star(10).size(), 10);
+    EXPECT_EQ(PolygonGenerator::spiral(100).size(), 100);
+    EXPECT_EQ(PolygonGenerator::comb(100).size(), 100);
+    EXPECT_EQ(PolygonGenerator::randomSimple(1000, 1).size(), 1000);
+}
+
+TEST(PolygonGeneratorTest, AllFamiliesAreSimpleAndCounterClockwise) {
+    for (const std::string& family : PolygonGenerator::families()) {
+        for (int n : {10, 100, 1000}) {
+            SkeletonConstruction::Polygon_2 polygon = toPolygon(PolygonGenerator::generate(family, n, 7));
+            EXPECT_TRUE(polygon.is_simple()) << family << " n=" << n;
+            EXPECT_TRUE(polygon.is_counterclockwise_oriented()) << family << " n=" << n;
+        }
+    }
+}
+
+TEST(PolygonGeneratorTest, FitsIntoPaper) {
+    for (const std::string& family : PolygonGenerator::families()) {
+        for (const auto& p : PolygonGenerator::generate(family, 500, 3)) {
+            EXPECT_GE(p.x(), 0);
+            EXPECT_GE(p.y(), 0);
+            EXPECT_LE(p.x(), 600);
+            EXPECT_LE(p.y(), 600);
+        }
+    }
+}
+
+TEST(PolygonGeneratorTest, RandomIsDeterministicPerSeed) {
+    EXPECT_EQ(PolygonGenerator::randomSimple(50, 5), PolygonGenerator::randomSimple(50, 5));
+    EXPECT_NE(PolygonGenerator::randomSimple(50, 5), PolygonGenerator::randomSimple(50, 6));
+}
+
+TEST(PolygonGeneratorTest, HardInputsAreDeterministicPerSeed) {
+    for (const std::string& family : {"reflex", "collinear", "symmetric"}) {
+        EXPECT_EQ(PolygonGenerator::generate(family, 60, 5), PolygonGenerator::generate(family, 60, 5)) << family;
+        EXPECT_NE(PolygonGenerator::generate(family, 60, 5), PolygonGenerator::generate(family, 60, 6)) << family;
+    }
+    EXPECT_EQ(PolygonGenerator::reflex(100, 1).size(), 100);
+    EXPECT_EQ(PolygonGenerator::nearCollinear(100, 1).size(), 100);
+    EXPECT_GT(PolygonGenerator::symmetric(100, 1).size(), 100 - 6);  // A multiple of the symmetry order
+    EXPECT_LE(PolygonGenerator::symmetric(100, 1).size(), 100);
+}
+
+TEST(PolygonGeneratorTest, UnknownFamilyThrows) {
+    EXPECT_THROW(PolygonGenerator::generate("hexagram", 10), std::invalid_argument);
+}
+
+}  // namespace OneCut
@@ -1,5 +1,7 @@
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <stdexcept>
 #include <vector>
 
 #include "OneCut/SkeletonBuilder.h"
@@ -50,6 +52,173 @@ TEST_F(SkeletonBuilderTest, BuildSkeletonWithConcavePolygon) {
     });
 }
 
+TEST_F(SkeletonBuilderTest, AdjacencyIsSymmetric) {
+    for (const auto& polygon : {square, triangle, rectangle, concave}) {
+        SkeletonBuilder builder(polygon);
+        auto skeleton = builder.buildSkeleton();
+        for (size_t i = 0; i < skeleton.faceCount(); i++) {
+            for (int adjacentFace : skeleton.face(i).adjacentFaces) {
+                if (adjacentFace < 0) {
+                    continue;
+                }
+                const auto& neighbours = skeleton.face(adjacentFace).adjacentFaces;
+                EXPECT_NE(std::find(neighbours.begin(), neighbours.end(), static_cast<int>(i)), neighbours.end());
+            }
+        }
+    }
+}
+
+TEST_F(SkeletonBuilderTest, InnerFacesAreLinkedToOuterFaces) {
+    SkeletonBuilder builder(concave);
+    auto skeleton = builder.buildSkeleton();
+    EXPECT_EQ(builder.getStats().innerFaceCount, concave.size());
+    for (size_t i = 0; i < builder.getStats().innerFaceCount; i++) {
+        const auto& face = skeleton.face(i);
+        EXPECT_EQ(std::count(face.adjacentFaces.begin(), face.adjacentFaces.end(), -1), 0);
+    }
+}
+
+TEST_F(SkeletonBuilderTest, TwinEdgesPointBack) {
+    for (const auto& polygon : {square, triangle, rectangle, concave}) {
+        SkeletonBuilder builder(polygon);
+        auto skeleton = builder.buildSkeleton();
+        for (size_t i = 0; i < skeleton.faceCount(); i++) {
+            const auto& face = skeleton.face(i);
+            ASSERT_EQ(face.twinEdges.size(), face.vertexCount());
+            for (size_t e = 0; e < face.vertexCount(); e++) {
+                int adjacentFace = face.adjacentFaces[e];
+                if (adjacentFace < 0) {
+                    EXPECT_EQ(face.twinEdges[e], -1);
+                    continue;
+                }
+                int twin = face.twinEdges[e];
+                const auto& neighbour = skeleton.face(adjacentFace);
+                ASSERT_GE(twin, 0);
+                EXPECT_EQ(neighbour.adjacentFaces[twin], static_cast<int>(i));
+                EXPECT_EQ(neighbour.twinEdges[twin], static_cast<int>(e));
+                EXPECT_EQ(neighbour.vertices[twin], face.vertices[(e + 1) % face.vertexCount()]);
+            }
+        }
+    }
+}
+
+TEST_F(SkeletonBuilderTest, OuterFacesAreClippedToPaper) {
+    OneCut::Paper paper{50, 50, 550, 550};
+    for (const auto& polygon : {square, triangle, concave}) {
+        SkeletonBuilder builder(polygon, ExteriorMode::EAGER, paper);
+        auto skeleton = builder.buildSkeleton();
+        EXPECT_EQ(skeleton.faceCount(), SkeletonBuilder(polygon).buildSkeleton().faceCount());
+        EXPECT_GT(builder.getStats().clippedOuterFaces, 0);
+
+        for (size_t i = 0; i < skeleton.faceCount(); i++) {
+            const auto& face = skeleton.face(i);
+            for (size_t e = 0; e < face.vertexCount(); e++) {
+                EXPECT_TRUE(paper.contains(CGAL::to_double(face.vertices[e].x()),
+                                           CGAL::to_double(face.vertices[e].y())));
+                int adjacentFace = face.adjacentFaces[e];
+                if (adjacentFace < 0) {
+                    EXPECT_EQ(face.twinEdges[e], -1);
+                    continue;
+                }
+                // Clipped edges still meet their twin exactly
+                int twin = face.twinEdges[e];
+                const auto& neighbour = skeleton.face(adjacentFace);
+                ASSERT_GE(twin, 0);
+                EXPECT_EQ(neighbour.adjacentFaces[twin], static_cast<int>(i));
+                EXPECT_EQ(neighbour.vertices[twin], face.vertices[(e + 1) % face.vertexCount()]);
+            }
+        }
+    }
+}
+
+TEST_F(SkeletonBuilderTest, LazyExteriorIsBuiltOnFirstRequest) {
+    SkeletonBuilder builder(square, ExteriorMode::LAZY);
+    EXPECT_FALSE(builder.hasExterior());
+    EXPECT_EQ(builder.getStats().outerFaceCount, 0);
+
+    auto interior = builder.buildInteriorSkeleton();
+    EXPECT_EQ(interior.faceCount(), square.size());
+    EXPECT_FALSE(builder.hasExterior());
+
+    auto skeleton = builder.buildSkeleton();
+    EXPECT_TRUE(builder.hasExterior());
+    EXPECT_EQ(skeleton.faceCount(), SkeletonBuilder(square).buildSkeleton().faceCount());
+}
+
+TEST_F(SkeletonBuilderTest, SkeletonsAreAllocatedFromTheArena) {
+    SkeletonBuilder builder(concave, ExteriorMode::LAZY);
+    size_t interiorBytes = builder.getStats().arenaBytes;
+    EXPECT_GT(interiorBytes, 0);
+
+    builder.buildSkeleton();
+    EXPECT_GT(builder.getStats().arenaBytes, interiorBytes);
+
+    // Moving the builder keeps the skeletons and their arena together
+    SkeletonBuilder moved = std::move(builder);
+    EXPECT_EQ(moved.buildSkeleton().faceCount(), SkeletonBuilder(concave).buildSkeleton().faceCount());
+}
+
+TEST_F(SkeletonBuilderTest, InteriorSkeletonHasNoOuterAdjacency) {
+    SkeletonBuilder builder(concave);
+    auto skeleton = builder.buildInteriorSkeleton();
+    for (size_t i = 0; i < skeleton.faceCount(); i++) {
+        EXPECT_FALSE(skeleton.face(i).isOuter);
+        for (int adjacentFace : skeleton.face(i).adjacentFaces) {
+            EXPECT_LT(adjacentFace, static_cast<int>(skeleton.faceCount()));
+        }
+    }
+}
+
+TEST_F(SkeletonBuilderTest, ShapeWithHole) {
+    Polygon_2 outer(square.begin(), square.end());
+    std::vector<Point> holePoints = {Point(200, 200), Point(400, 200), Point(400, 400), Point(200, 400)};
+    Polygon_with_holes_2 shape(outer);
+    shape.add_hole(Polygon_2(holePoints.begin(), holePoints.end()));
+
+    SkeletonBuilder builder(std::vector<Polygon_with_holes_2>{shape});
+    auto skeleton = builder.buildSkeleton();
+
+    // One face per contour edge: 4 + 4 inside, frame region 4 + 4 and the inside of the hole 4
+    EXPECT_EQ(builder.getStats().innerFaceCount, 8);
+    EXPECT_EQ(builder.getStats().outerFaceCount, 12);
+    EXPECT_EQ(builder.getStats().edgeMapMisses, 4);  // The frame edges only
+    for (size_t i = 0; i < skeleton.faceCount(); i++) {
+        for (int adjacentFace : skeleton.face(i).adjacentFaces) {
+            if (adjacentFace >= 0) {
+                const auto& neighbours = skeleton.face(adjacentFace).adjacentFaces;
+                EXPECT_NE(std::find(neighbours.begin(), neighbours.end(), static_cast<int>(i)), neighbours.end());
+            }
+        }
+    }
+}
+
+TEST_F(SkeletonBuilderTest, DisjointShapesShareOneExterior) {
+    std::vector<Point> farSquare = {Point(900, 100), Point(1300, 100), Point(1300, 500), Point(900, 500)};
+    std::vector<Polygon_with_holes_2> shapes = {Polygon_with_holes_2(Polygon_2(square.begin(), square.end())),
+                                                Polygon_with_holes_2(Polygon_2(farSquare.rbegin(), farSquare.rend()))};
+
+    SkeletonBuilder builder(shapes);
+    auto skeleton = builder.buildSkeleton();
+
+    EXPECT_EQ(builder.getStats().polygonVertexCount, 8);
+    EXPECT_EQ(builder.getStats().innerFaceCount, 8);
+    EXPECT_EQ(builder.getStats().outerFaceCount, 12);
+    EXPECT_EQ(builder.getStats().edgeMapMisses, 4);
+    EXPECT_EQ(builder.buildInteriorSkeleton().faceCount(), 8);
+}
+
+TEST_F(SkeletonBuilderTest, RejectsPolygonOffPaper) {
+    OneCut::Paper paper;
+    EXPECT_NO_THROW(SkeletonBuilder(square, ExteriorMode::LAZY, paper));
+    EXPECT_NO_THROW(SkeletonBuilder(square, ExteriorMode::LAZY, OneCut::Paper{100, 100, 500, 500}));
+
+    std::vector<Point> farSquare = {Point(900, 100), Point(1300, 100), Point(1300, 500), Point(900, 500)};
+    EXPECT_THROW(SkeletonBuilder(farSquare, ExteriorMode::LAZY, paper), std::invalid_argument);
+    EXPECT_THROW(SkeletonBuilder(square, ExteriorMode::LAZY, OneCut::Paper{200, 0, 600, 600}), std::invalid_argument);
+    EXPECT_NO_THROW(SkeletonBuilder(farSquare, ExteriorMode::LAZY, OneCut::Paper::unbounded()));
+    EXPECT_NO_THROW(SkeletonBuilder(farSquare, ExteriorMode::LAZY));
+}
+
 TEST_F(SkeletonBuilderTest, BuildSkeletonWithEmptyPolygon) {
     std::vector<Point> empty;
     EXPECT_ANY_THROW({
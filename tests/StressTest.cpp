@@ -0,0 +1,297 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "OneCut/FoldManager.h"
+#include "OneCut/FoldReader.h"
+#include "OneCut/PerpendicularFinder.h"
+#include "OneCut/SkeletonBuilder.h"
+#include "OneCut/utils/PolygonGenerator.h"
+
+#ifndef ONECUT_RESOURCE_DIR
+#define ONECUT_RESOURCE_DIR "resources"
+#endif
+#ifndef ONECUT_BASELINE_FILE
+#define ONECUT_BASELINE_FILE "tests/baselines/performance.txt"
+#endif
+
+namespace OneCut {
+
+namespace {
+
+/// Input polygon, in the point type of the SkeletonBuilder
+using Polygon = std::vector<SkeletonConstruction::Point>;
+
+/// Polygon sizes of the invariant tests
+const std::vector<int> STRESS_SIZES = {16, 64, 256};
+/// Seeds per family and size, raised with ONECUT_STRESS_SEEDS for longer runs
+constexpr unsigned DEFAULT_STRESS_SEEDS = 4;
+
+/// Allowed slowdown against the baseline, overridden with ONECUT_RUNTIME_TOLERANCE
+constexpr double DEFAULT_RUNTIME_TOLERANCE = 1.5;
+/// Allowed memory growth against the baseline, overridden with ONECUT_MEMORY_TOLERANCE
+constexpr double DEFAULT_MEMORY_TOLERANCE = 1.2;
+/// Runs per measurement; the fastest one is kept
+constexpr int TIMING_RUNS = 3;
+
+double environmentValue(const char* name, double fallback) {
+    const char* value = std::getenv(name);
+    return value ? std::atof(value) : fallback;
+}
+
+bool isFinite(const Point& p) {
+    return std::isfinite(CGAL::to_double(p.x())) && std::isfinite(CGAL::to_double(p.y()));
+}
+
+bool onPaper(const Paper& paper, double x, double y) {
+    return std::isfinite(x) && std::isfinite(y) && paper.contains(x, y);
+}
+
+// Checks the face structure of a skeleton clipped to the paper.
+void expectSkeletonInvariants(const StraightSkeleton& skeleton, const SkeletonConstruction::SkeletonBuilder& builder,
+                              size_t polygonVertexCount, const Paper& paper) {
+    EXPECT_EQ(builder.getStats().innerFaceCount, polygonVertexCount);
+    EXPECT_EQ(skeleton.faceCount(), builder.getStats().innerFaceCount + builder.getStats().outerFaceCount);
+
+    for (size_t i = 0; i < skeleton.faceCount(); i++) {
+        const SkeletonFace& face = skeleton.face(i);
+        ASSERT_EQ(face.adjacentFaces.size(), face.vertexCount()) << "face " << i;
+        ASSERT_EQ(face.twinEdges.size(), face.vertexCount()) << "face " << i;
+        if (face.vertexCount() == 0) {
+            EXPECT_TRUE(face.isOuter) << "face " << i;  // Clipped away entirely
+            continue;
+        }
+        EXPECT_GE(face.vertexCount(), 3) << "face " << i;
+
+        for (size_t e = 0; e < face.vertexCount(); e++) {
+            const Point& vertex = face.vertices[e];
+            EXPECT_TRUE(onPaper(paper, CGAL::to_double(vertex.x()), CGAL::to_double(vertex.y())))
+                << "face " << i << " vertex " << e;
+
+            int adjacentFace = face.adjacentFaces[e];
+            if (adjacentFace < 0) {
+                EXPECT_TRUE(face.isOuter) << "inner face " << i << " has an open edge " << e;
+                EXPECT_EQ(face.twinEdges[e], -1);
+                continue;
+            }
+            ASSERT_LT(adjacentFace, static_cast<int>(skeleton.faceCount()));
+            const SkeletonFace& neighbour = skeleton.face(adjacentFace);
+            int twin = face.twinEdges[e];
+            ASSERT_GE(twin, 0) << "face " << i << " edge " << e;
+            ASSERT_LT(twin, static_cast<int>(neighbour.vertexCount()));
+            EXPECT_EQ(neighbour.adjacentFaces[twin], static_cast<int>(i));
+            EXPECT_EQ(neighbour.twinEdges[twin], static_cast<int>(e));
+            EXPECT_EQ(neighbour.vertices[twin], face.vertices[(e + 1) % face.vertexCount()]);
+        }
+    }
+}
+
+// Checks that every chain is a connected path through adjacent faces that stays on the paper.
+void expectChainInvariants(const StraightSkeleton& skeleton, const Paper& paper) {
+    FastPerpendicularFinder finder(skeleton);
+    finder.setPaper(paper);
+    PipelineStats stats;
+    std::vector<BasicPerpChain<FastKernel>> chains = finder.findPerpendiculars(stats);
+    const std::vector<ChainTermination>& terminations = finder.getTerminations();
+
+    ASSERT_EQ(terminations.size(), chains.size());
+    EXPECT_EQ(stats.chainCount, chains.size());
+    EXPECT_GT(stats.boundaryStops, 0);
+    EXPECT_EQ(std::count(terminations.begin(), terminations.end(), ChainTermination::EDGE_LOOKUP_FAILED), 0);
+
+    for (size_t c = 0; c < chains.size(); c++) {
+        const BasicPerpChain<FastKernel>& chain = chains[c];
+        ASSERT_FALSE(chain.empty()) << "chain " << c;
+        EXPECT_LE(chain.size(), static_cast<size_t>(finder.getChainBudget()));
+        for (size_t s = 0; s < chain.size(); s++) {
+            const BasicPerpSegment<FastKernel>& segment = chain[s];
+            ASSERT_GE(segment.faceIndex, 0);
+            ASSERT_LT(segment.faceIndex, static_cast<int>(skeleton.faceCount()));
+            EXPECT_TRUE(onPaper(paper, segment.start.x(), segment.start.y())) << "chain " << c << " segment " << s;
+            EXPECT_TRUE(onPaper(paper, segment.end.x(), segment.end.y())) << "chain " << c << " segment " << s;
+            if (s + 1 == chain.size()) {
+                continue;
+            }
+            EXPECT_EQ(segment.end, chain[s + 1].start) << "chain " << c << " is broken after segment " << s;
+            const std::vector<int>& neighbours = skeleton.face(segment.faceIndex).adjacentFaces;
+            EXPECT_NE(std::find(neighbours.begin(), neighbours.end(), chain[s + 1].faceIndex), neighbours.end())
+                << "chain " << c << " jumps from face " << segment.faceIndex << " to " << chain[s + 1].faceIndex;
+        }
+    }
+}
+
+void expectCreaseInvariants(const Polygon& polygon) {
+    std::vector<Crease> creases = FoldManager(polygon).getCreases();
+    EXPECT_GE(creases.size(), polygon.size());
+    for (const Crease& crease : creases) {
+        EXPECT_TRUE(isFinite(crease.edge.first) && isFinite(crease.edge.second));
+    }
+}
+
+void expectPipelineInvariants(const Polygon& polygon) {
+    Paper paper;
+    SkeletonConstruction::SkeletonBuilder builder(polygon, SkeletonConstruction::ExteriorMode::EAGER, paper);
+    StraightSkeleton skeleton = builder.buildSkeleton();
+    expectSkeletonInvariants(skeleton, builder, polygon.size(), paper);
+    expectChainInvariants(skeleton, paper);
+    expectCreaseInvariants(polygon);
+}
+
+}  // namespace
+
+class StressTest : public ::testing::TestWithParam<std::string> {};
+
+TEST_P(StressTest, RandomPolygonsKeepInvariants) {
+    auto seedCount = static_cast<unsigned>(environmentValue("ONECUT_STRESS_SEEDS", DEFAULT_STRESS_SEEDS));
+    for (int n : STRESS_SIZES) {
+        for (unsigned seed = 1; seed <= seedCount; seed++) {
+            Polygon polygon = PolygonGenerator::generate(GetParam(), n, seed);
+            SCOPED_TRACE(GetParam() + " n=" + std::to_string(n) + " seed=" + std::to_string(seed));
+            ASSERT_TRUE(SkeletonConstruction::Polygon_2(polygon.begin(), polygon.end()).is_simple());
+            expectPipelineInvariants(polygon);
+        }
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(HardFamilies, StressTest,
+                         ::testing::Values("reflex", "collinear", "symmetric", "random"),
+                         [](const ::testing::TestParamInfo<std::string>& info) { return info.param; });
+
+TEST(ResourceStressTest, FoldFilesKeepInvariants) {
+    std::vector<std::filesystem::path> files;
+    for (const auto& entry : std::filesystem::directory_iterator(ONECUT_RESOURCE_DIR)) {
+        if (entry.path().extension() == ".fold") {
+            files.push_back(entry.path());
+        }
+    }
+    ASSERT_FALSE(files.empty()) << "No FOLD files in " << ONECUT_RESOURCE_DIR;
+    std::sort(files.begin(), files.end());
+
+    for (const std::filesystem::path& file : files) {
+        for (const Polygon& polygon : FoldReader::read(file.string()).boundaryPolygons()) {
+            SCOPED_TRACE(file.filename().string());
+            expectPipelineInvariants(polygon);
+        }
+    }
+}
+
+/**
+ * Compares the runtime and the skeleton memory of fixed inputs with tests/baselines/performance.txt.
+ *
+ * Runtimes are stored relative to a calibration polygon measured in the same run, which makes
+ * them comparable across machines of similar architecture. Memory is the arena size of the
+ * skeletons, which does not depend on the machine. A missing or empty baseline file and cases
+ * without a baseline fail, so the check cannot silently turn itself off;
+ * ONECUT_UPDATE_BASELINES=1 records the current measurements instead of comparing them.
+ * CTest only registers it when configured with ONECUT_PERF_BASELINES=ON.
+ */
+class PerformanceRegressionTest : public ::testing::Test {
+   protected:
+    struct Measurement {
+        double relativeRuntime = 0;
+        size_t arenaBytes = 0;
+    };
+
+    static Polygon calibrationPolygon() { return PolygonGenerator::convex(1000); }
+
+    static std::map<std::string, Polygon> cases() {
+        return {{"reflex-1000", PolygonGenerator::reflex(1000, 1)},
+                {"collinear-1000", PolygonGenerator::nearCollinear(1000, 1)},
+                {"symmetric-1000", PolygonGenerator::symmetric(1000, 1)},
+                {"random-1000", PolygonGenerator::randomSimple(1000, 1)},
+                {"comb-1000", PolygonGenerator::comb(1000)}};
+    }
+
+    // Fastest full crease computation out of TIMING_RUNS, in ms.
+    static double fastestRun(const Polygon& polygon, PipelineStats& stats) {
+        double fastest = 0;
+        for (int run = 0; run < TIMING_RUNS; run++) {
+            stats = PipelineStats();
+            auto start = std::chrono::steady_clock::now();
+            FoldManager(polygon).getCreases(stats);
+            double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+            fastest = run == 0 ? ms : std::min(fastest, ms);
+        }
+        return fastest;
+    }
+
+    static std::map<std::string, Measurement> readBaselines(const std::string& path) {
+        std::map<std::string, Measurement> baselines;
+        std::ifstream file(path);
+        EXPECT_TRUE(file.is_open()) << "Cannot open " << path;
+        std::string line;
+        while (std::getline(file, line)) {
+            if (line.empty() || line[0] == '#') {
+                continue;
+            }
+            std::istringstream fields(line);
+            std::string name;
+            Measurement measurement;
+            if (fields >> name >> measurement.relativeRuntime >> measurement.arenaBytes) {
+                baselines[name] = measurement;
+            } else {
+                ADD_FAILURE() << "Malformed baseline in " << path << ": " << line;
+            }
+        }
+        return baselines;
+    }
+
+    static void writeBaselines(const std::string& path, const std::map<std::string, Measurement>& measurements) {
+        std::ofstream file(path);
+        file << "# Performance baselines of PerformanceRegressionTest (tests/StressTest.cpp).\n"
+             << "# <case> <runtime relative to the calibration polygon> <skeleton arena bytes>\n"
+             << "# Record on the reference machine with a release build configured with ONECUT_PERF_BASELINES=ON:\n"
+             << "# ONECUT_UPDATE_BASELINES=1 ctest -L stress\n"
+             << "# Every case needs a line; the test fails on a missing case or an empty file.\n";
+        for (const auto& [name, measurement] : measurements) {
+            file << name << ' ' << measurement.relativeRuntime << ' ' << measurement.arenaBytes << '\n';
+        }
+    }
+};
+
+TEST_F(PerformanceRegressionTest, RuntimeAndMemoryWithinBaselines) {
+    PipelineStats stats;
+    double calibrationMs = fastestRun(calibrationPolygon(), stats);
+    ASSERT_GT(calibrationMs, 0);
+
+    std::map<std::string, Measurement> measurements;
+    for (const auto& [name, polygon] : cases()) {
+        double ms = fastestRun(polygon, stats);
+        measurements[name] = {ms / calibrationMs, stats.arenaBytes};
+    }
+
+    const char* update = std::getenv("ONECUT_UPDATE_BASELINES");
+    if (update && std::string(update) == "1") {
+        writeBaselines(ONECUT_BASELINE_FILE, measurements);
+        GTEST_SKIP() << "Recorded " << measurements.size() << " baselines in " << ONECUT_BASELINE_FILE;
+    }
+
+    double runtimeTolerance = environmentValue("ONECUT_RUNTIME_TOLERANCE", DEFAULT_RUNTIME_TOLERANCE);
+    double memoryTolerance = environmentValue("ONECUT_MEMORY_TOLERANCE", DEFAULT_MEMORY_TOLERANCE);
+    std::map<std::string, Measurement> baselines = readBaselines(ONECUT_BASELINE_FILE);
+    ASSERT_FALSE(baselines.empty()) << "No baselines recorded in " << ONECUT_BASELINE_FILE
+                                    << "; record them with ONECUT_UPDATE_BASELINES=1";
+    for (const auto& [name, measurement] : measurements) {
+        auto baseline = baselines.find(name);
+        if (baseline == baselines.end()) {
+            ADD_FAILURE() << "No baseline for " << name << " in " << ONECUT_BASELINE_FILE;
+            continue;
+        }
+        EXPECT_LE(measurement.relativeRuntime, baseline->second.relativeRuntime * runtimeTolerance)
+            << name << " got slower (relative runtime, baseline " << baseline->second.relativeRuntime << ")";
+        EXPECT_LE(static_cast<double>(measurement.arenaBytes),
+                  static_cast<double>(baseline->second.arenaBytes) * memoryTolerance)
+            << name << " needs more skeleton memory (baseline " << baseline->second.arenaBytes << " bytes)";
+    }
+}
+
+}  // namespace OneCut
@@ -0,0 +1,127 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <memory>
+#include <set>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "OneCut/FoldManager.h"
+#include "OneCut/Tracer.h"
+#include "OneCut/utils/PolygonGenerator.h"
+
+namespace OneCut {
+
+namespace {
+
+size_t countEvents(const std::vector<TraceEvent>& events, const std::string& name) {
+    return std::count_if(events.begin(), events.end(), [&name](const TraceEvent& event) {
+        return event.name == name;
+    });
+}
+
+bool hasArg(const TraceEvent& event, const std::string& key) {
+    return std::any_of(event.args.begin(), event.args.end(), [&key](const auto& arg) { return arg.first == key; });
+}
+
+}  // namespace
+
+TEST(TracerTest, NothingIsRecordedWithoutInstalledTracer) {
+    Tracer tracer;
+    ASSERT_EQ(Tracer::active(), nullptr);
+    FoldManager(PolygonGenerator::generate("comb", 40)).getCreases();
+    EXPECT_TRUE(tracer.events().empty());
+
+    TraceSpan span("unused", "test");
+    EXPECT_FALSE(span.enabled());
+}
+
+TEST(TracerTest, RecordsEveryStageAndChain) {
+    auto tracer = std::make_shared<Tracer>();
+    Tracer::install(tracer);
+    PipelineStats stats;
+    FoldManager(PolygonGenerator::generate("comb", 100)).getCreases(stats);
+    Tracer::install(nullptr);
+
+    std::vector<TraceEvent> events = tracer->events();
+    for (const char* stage : {"interior skeleton", "exterior skeleton", "construct skeleton", "inner faces",
+                              "outer faces", "clip outer faces", "perpendicular graph", "crease assembly"}) {
+        EXPECT_GE(countEvents(events, stage), 1) << stage;
+    }
+    EXPECT_GE(countEvents(events, "chain"), stats.chainCount);
+
+    for (const TraceEvent& event : events) {
+        EXPECT_GE(event.durationUs, 0) << event.name;
+        EXPECT_EQ(event.threadId, 1) << event.name;
+        if (event.name == "chain") {
+            EXPECT_TRUE(hasArg(event, "seedFace"));
+            EXPECT_TRUE(hasArg(event, "seedVertex"));
+            EXPECT_TRUE(hasArg(event, "iterations"));
+            EXPECT_TRUE(hasArg(event, "termination"));
+        }
+    }
+}
+
+TEST(TracerTest, BatchSpansCarryThreadIds) {
+    std::vector<std::vector<SkeletonConstruction::Point>> polygons;
+    for (uint32_t seed = 0; seed < 8; seed++) {
+        polygons.push_back(PolygonGenerator::generate("random", 50, seed));
+    }
+
+    auto tracer = std::make_shared<Tracer>();
+    Tracer::install(tracer);
+    FoldManager::computeBatch(polygons, FoldOptions(), 4);
+    Tracer::install(nullptr);
+
+    std::vector<TraceEvent> events = tracer->events();
+    EXPECT_EQ(countEvents(events, "polygon"), polygons.size());
+    std::set<int> threadIds;
+    for (const TraceEvent& event : events) {
+        threadIds.insert(event.threadId);
+    }
+    EXPECT_GE(*threadIds.begin(), 1);
+    EXPECT_LE(*threadIds.rbegin(), 4);
+}
+
+TEST(TracerTest, SpansKeepTheirTracerAlive) {
+    auto tracer = std::make_shared<Tracer>();
+    std::weak_ptr<Tracer> observer = tracer;
+    Tracer::install(tracer);
+    tracer.reset();
+    {
+        TraceSpan span("outlives installation", "test");
+        Tracer::install(nullptr);
+        EXPECT_FALSE(observer.expired());
+        EXPECT_TRUE(span.enabled());
+    }
+    EXPECT_TRUE(observer.expired());
+
+    TraceSpan span("after uninstall", "test");
+    EXPECT_FALSE(span.enabled());
+}
+
+TEST(TracerTest, WritesChromeTraceEvents) {
+    auto tracer = std::make_shared<Tracer>();
+    Tracer::install(tracer);
+    {
+        TraceSpan span("quoted \"name\"", "test");
+        span.arg("count", 3);
+        span.arg("label", "a\\b");
+    }
+    Tracer::install(nullptr);
+    ASSERT_EQ(tracer->events().size(), 1);
+
+    std::ostringstream os;
+    tracer->write(os);
+    std::string json = os.str();
+    EXPECT_NE(json.find("\"traceEvents\":["), std::string::npos);
+    EXPECT_NE(json.find("\"name\":\"quoted \\\"name\\\"\",\"cat\":\"test\",\"ph\":\"X\""), std::string::npos);
+    EXPECT_NE(json.find("\"args\":{\"count\":3,\"label\":\"a\\\\b\"}"), std::string::npos);
+    EXPECT_NE(json.find("\"thread_name\""), std::string::npos);
+
+    tracer->clear();
+    EXPECT_TRUE(tracer->events().empty());
+}
+
+}  // namespace OneCut
@@ -0,0 +1,58 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+
+#include "OneCut/utils/WeldGrid.h"
+
+namespace OneCut {
+
+TEST(WeldGridTest, WeldsAcrossCellBorders) {
+    const double tolerance = 1e-7;
+    // Pairs 1e-12 apart on both sides of a cell border and of a cell center
+    for (double base : {3 * tolerance, 3.5 * tolerance, -2 * tolerance, -2.5 * tolerance}) {
+        WeldGrid grid(tolerance);
+        auto [first, firstInserted] = grid.insert(base - 1e-12, base - 1e-12);
+        auto [second, secondInserted] = grid.insert(base + 1e-12, base + 1e-12);
+        EXPECT_TRUE(firstInserted);
+        EXPECT_FALSE(secondInserted) << base;
+        EXPECT_EQ(first, second) << base;
+        EXPECT_EQ(grid.size(), 1);
+    }
+}
+
+TEST(WeldGridTest, KeepsDistantPointsApart) {
+    WeldGrid grid(1e-7);
+    EXPECT_EQ(grid.insert(0, 0).first, 0);
+    EXPECT_EQ(grid.insert(1.5e-7, 0).first, 1);
+    EXPECT_EQ(grid.insert(0, 1.5e-7).first, 2);
+    EXPECT_EQ(grid.insert(0.9e-7, 0.9e-7).first, 3);  // 1.27e-7 away from the first point
+    EXPECT_EQ(grid.size(), 4);
+}
+
+TEST(WeldGridTest, WeldsToNearestVertex) {
+    WeldGrid grid(1.0);
+    grid.insert(0, 0);
+    grid.insert(1.5, 0);
+    EXPECT_EQ(grid.insert(0.9, 0).first, 1);
+    EXPECT_EQ(grid.insert(0.4, 0).first, 0);
+}
+
+TEST(WeldGridTest, ZeroToleranceWeldsEqualCoordinates) {
+    WeldGrid grid;
+    EXPECT_EQ(grid.insert(1, 2).first, 0);
+    EXPECT_EQ(grid.insert(1, 2 + 1e-15).first, 1);
+    EXPECT_EQ(grid.insert(0.0, 0.0).first, 2);
+    EXPECT_EQ(grid.insert(-0.0, -0.0).first, 2);
+    EXPECT_EQ(grid.size(), 3);
+
+    grid.clear();
+    EXPECT_EQ(grid.size(), 0);
+    EXPECT_TRUE(grid.insert(1, 2).second);
+}
+
+TEST(WeldGridTest, CanonicalZero) {
+    EXPECT_FALSE(std::signbit(canonicalZero(-0.0)));
+    EXPECT_EQ(canonicalZero(-1.5), -1.5);
+}
+
+}  // namespace OneCut
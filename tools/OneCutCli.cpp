@@ -0,0 +1,381 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#if !defined(_WIN32)
+#include <sys/resource.h>
+#endif
+
+#include "OneCut/FoldManager.h"
+#include "OneCut/FoldReader.h"
+#include "OneCut/FoldWriter.h"
+#include "OneCut/Tracer.h"
+
+/*
+ * onecut_cli: computes the crease patterns of polygon and FOLD files without Python or the GUI.
+ *
+ * Every input is a FOLD file (*.fold, its boundary polygons are used) or a polygon file (*.poly,
+ * one "x y" vertex per line, a blank line starts the next polygon, # starts a comment).
+ * Directories are searched recursively for both. The crease pattern of polygon k of input
+ * dir/name.ext is written to dir/name.creases.fold, or dir/name.k.creases.fold if the input
+ * holds several polygons. Files named *.creases.fold are never used as inputs.
+ *
+ * Usage: onecut_cli [--threads N] [--interior-only] [--exact-kernel] [--chain-budget N] [--job-budget N]
+ *                   [--paper XMIN,YMIN,XMAX,YMAX|fit|unbounded] [--trace FILE] INPUT...
+ *
+ * --chain-budget and --job-budget bound the perpendicular tracing per chain and per polygon
+ * (FoldOptions::chainBudget and FoldOptions::jobBudget), which caps the time of pathological inputs.
+ * --paper sets the sheet (FoldOptions::paper, none by default); "fit" uses the bounding box of each
+ * polygon and "unbounded" keeps the whole exterior skeleton. Polygons that do not lie on the given
+ * sheet fail.
+ * --trace writes a Chrome trace-event JSON of all polygons (chrome://tracing, ui.perfetto.dev), with
+ * one span per polygon, skeleton stage and perpendicular chain, to find out why one polygon was slow.
+ */
+
+namespace fs = std::filesystem;
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+const std::string OUTPUT_SUFFIX = ".creases.fold";
+
+struct Options {
+    int threadCount = 0;
+    OneCut::FoldOptions foldOptions;
+    bool fitPaper = false;  ///< Use the bounding box of each polygon as its paper
+    std::string tracePath;  ///< Destination of the trace; empty for no tracing
+    std::vector<std::string> inputs;
+};
+
+/**
+ * Latencies and failures collected by one worker, merged after all workers finished.
+ */
+struct WorkerReport {
+    std::vector<double> latenciesMs;  ///< Read share, computation and writing of every polygon
+    size_t failures = 0;
+};
+
+double elapsedMs(Clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+bool endsWith(const std::string& text, const std::string& suffix) {
+    return text.size() >= suffix.size() && text.compare(text.size() - suffix.size(), suffix.size(), suffix) == 0;
+}
+
+[[noreturn]] void exitWithUsage(int status) {
+    std::cerr << "Usage: onecut_cli [--threads N] [--interior-only] [--exact-kernel]\n"
+                 "                  [--chain-budget N] [--job-budget N]\n"
+                 "                  [--paper XMIN,YMIN,XMAX,YMAX|fit|unbounded] [--trace FILE] INPUT...\n"
+                 "       INPUT is a .fold or .poly file or a directory searched for them"
+              << std::endl;
+    std::exit(status);
+}
+
+// Parses "XMIN,YMIN,XMAX,YMAX" into a paper, or returns false.
+bool parsePaper(std::string text, OneCut::Paper& paper) {
+    std::replace(text.begin(), text.end(), ',', ' ');
+    std::istringstream stream(text);
+    std::string rest;
+    return stream >> paper.xMin >> paper.yMin >> paper.xMax >> paper.yMax && !(stream >> rest) &&
+           paper.xMin < paper.xMax && paper.yMin < paper.yMax;
+}
+
+OneCut::Paper boundingBox(const std::vector<SkeletonConstruction::Point>& polygon) {
+    OneCut::Paper box{polygon[0].x(), polygon[0].y(), polygon[0].x(), polygon[0].y()};
+    for (const SkeletonConstruction::Point& p : polygon) {
+        box.xMin = std::min(box.xMin, p.x());
+        box.yMin = std::min(box.yMin, p.y());
+        box.xMax = std::max(box.xMax, p.x());
+        box.yMax = std::max(box.yMax, p.y());
+    }
+    return box;
+}
+
+// Parses the value of an unsigned option; std::stoull alone would wrap negative numbers around.
+size_t parseSize(const std::string& text) {
+    if (text.find('-') != std::string::npos) {
+        throw std::invalid_argument(text);
+    }
+    return std::stoull(text);
+}
+
+Options parseOptions(int argc, char** argv) {
+    Options options;
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        try {
+            if (arg == "--threads" && i + 1 < argc) {
+                options.threadCount = std::max(0, std::stoi(argv[++i]));
+            } else if (arg == "--interior-only") {
+                options.foldOptions.interiorOnly = true;
+            } else if (arg == "--exact-kernel") {
+                options.foldOptions.exactKernel = true;
+            } else if (arg == "--chain-budget" && i + 1 < argc) {
+                options.foldOptions.chainBudget = std::max(0, std::stoi(argv[++i]));
+            } else if (arg == "--job-budget" && i + 1 < argc) {
+                options.foldOptions.jobBudget = parseSize(argv[++i]);
+            } else if (arg == "--paper" && i + 1 < argc) {
+                std::string paper = argv[++i];
+                if (paper == "fit") {
+                    options.fitPaper = true;
+                } else if (paper == "unbounded") {
+                    options.foldOptions.paper = OneCut::Paper::unbounded();
+                } else {
+                    OneCut::Paper sheet;
+                    if (!parsePaper(paper, sheet)) {
+                        throw std::invalid_argument(paper);
+                    }
+                    options.foldOptions.paper = sheet;
+                }
+            } else if (arg == "--trace" && i + 1 < argc) {
+                options.tracePath = argv[++i];
+            } else if (!arg.empty() && arg[0] != '-') {
+                options.inputs.push_back(arg);
+            } else {
+                exitWithUsage(arg == "--help" ? 0 : 2);
+            }
+        } catch (const std::logic_error&) {  // std::invalid_argument and std::out_of_range
+            std::cerr << "Invalid value \"" << argv[i] << "\" for " << arg << std::endl;
+            exitWithUsage(2);
+        }
+    }
+    if (options.inputs.empty()) {
+        std::cerr << "No input given; see onecut_cli --help" << std::endl;
+        std::exit(2);
+    }
+    return options;
+}
+
+bool isInput(const fs::path& path) {
+    std::string name = path.filename().string();
+    return (path.extension() == ".fold" && !endsWith(name, OUTPUT_SUFFIX)) || path.extension() == ".poly";
+}
+
+/**
+ * Expands directories into their input files, sorted so that runs are reproducible.
+ */
+std::vector<fs::path> collectFiles(const std::vector<std::string>& inputs) {
+    std::vector<fs::path> files;
+    for (const std::string& input : inputs) {
+        if (!fs::is_directory(input)) {
+            files.emplace_back(input);
+            continue;
+        }
+        std::vector<fs::path> found;
+        for (const fs::directory_entry& entry : fs::recursive_directory_iterator(input)) {
+            if (entry.is_regular_file() && isInput(entry.path())) {
+                found.push_back(entry.path());
+            }
+        }
+        std::sort(found.begin(), found.end());
+        files.insert(files.end(), found.begin(), found.end());
+    }
+    return files;
+}
+
+std::vector<std::vector<SkeletonConstruction::Point>> readPolygonFile(const fs::path& path) {
+    std::ifstream file(path);
+    if (!file) {
+        throw std::runtime_error("Cannot open " + path.string());
+    }
+    std::vector<std::vector<SkeletonConstruction::Point>> polygons(1);
+    std::string line;
+    for (int lineNumber = 1; std::getline(file, line); lineNumber++) {
+        line = line.substr(0, line.find('#'));
+        std::replace(line.begin(), line.end(), ',', ' ');
+        std::istringstream stream(line);
+        double x;
+        double y;
+        if (!(stream >> x)) {
+            if (!polygons.back().empty()) {
+                polygons.emplace_back();
+            }
+            continue;
+        }
+        if (!(stream >> y)) {
+            throw std::runtime_error(path.string() + ":" + std::to_string(lineNumber) + ": expected \"x y\"");
+        }
+        polygons.back().emplace_back(x, y);
+    }
+    if (polygons.back().empty()) {
+        polygons.pop_back();
+    }
+    return polygons;
+}
+
+std::vector<std::vector<SkeletonConstruction::Point>> readPolygons(const fs::path& path) {
+    if (path.extension() == ".fold") {
+        return OneCut::FoldReader::read(path.string()).boundaryPolygons();
+    }
+    return readPolygonFile(path);
+}
+
+fs::path outputPath(const fs::path& input, size_t polygon, size_t polygonCount) {
+    std::string stem = input.stem().string();
+    if (polygonCount > 1) {
+        stem += "." + std::to_string(polygon);
+    }
+    return input.parent_path() / (stem + OUTPUT_SUFFIX);
+}
+
+void processFile(const fs::path& path, const Options& options, const OneCut::FoldWriter& writer,
+                 WorkerReport& report, std::mutex& errorMutex) {
+    auto fail = [&](const std::string& message) {
+        report.failures++;
+        std::lock_guard<std::mutex> lock(errorMutex);
+        std::cerr << path.string() << ": " << message << std::endl;
+    };
+
+    auto readStart = Clock::now();
+    std::vector<std::vector<SkeletonConstruction::Point>> polygons;
+    try {
+        polygons = readPolygons(path);
+    } catch (const std::exception& e) {
+        fail(e.what());
+        return;
+    }
+    if (polygons.empty()) {
+        fail("no polygon found");
+        return;
+    }
+    // Reading is shared by the polygons of a file
+    double readShareMs = elapsedMs(readStart) / polygons.size();
+
+    for (size_t i = 0; i < polygons.size(); i++) {
+        auto start = Clock::now();
+        OneCut::TraceSpan span("polygon", "cli");
+        if (span.enabled()) {
+            span.arg("file", path.string());
+            span.arg("index", static_cast<std::int64_t>(i));
+            span.arg("vertices", static_cast<std::int64_t>(polygons[i].size()));
+        }
+        try {
+            if (polygons[i].size() < 3) {
+                throw std::invalid_argument("polygon " + std::to_string(i) + " has fewer than 3 vertices");
+            }
+            OneCut::FoldOptions foldOptions = options.foldOptions;
+            if (options.fitPaper) {
+                foldOptions.paper = boundingBox(polygons[i]);
+            }
+            std::vector<OneCut::Crease> creases = OneCut::FoldManager(polygons[i], foldOptions).getCreases();
+            writer.writeFile(outputPath(path, i, polygons.size()).string(), polygons[i], creases);
+            report.latenciesMs.push_back(readShareMs + elapsedMs(start));
+        } catch (const std::exception& e) {
+            fail(e.what());
+        }
+    }
+}
+
+double percentile(const std::vector<double>& sorted, double fraction) {
+    if (sorted.empty()) {
+        return 0;
+    }
+    size_t index = static_cast<size_t>(fraction * (sorted.size() - 1) + 0.5);
+    return sorted[std::min(index, sorted.size() - 1)];
+}
+
+/**
+ * Peak resident set size of the process in MiB, or a negative value where it is not available.
+ */
+double peakRssMb() {
+#if defined(_WIN32)
+    return -1;
+#else
+    rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) != 0) {
+        return -1;
+    }
+#if defined(__APPLE__)
+    return usage.ru_maxrss / (1024.0 * 1024.0);  // bytes
+#else
+    return usage.ru_maxrss / 1024.0;  // KiB
+#endif
+#endif
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    Options options = parseOptions(argc, argv);
+    std::vector<fs::path> files;
+    try {
+        files = collectFiles(options.inputs);
+    } catch (const fs::filesystem_error& e) {
+        std::cerr << e.what() << std::endl;
+        return 2;
+    }
+
+    size_t workerCount =
+        options.threadCount > 0 ? options.threadCount : std::max(1u, std::thread::hardware_concurrency());
+    workerCount = std::max<size_t>(1, std::min(workerCount, files.size()));
+    OneCut::FoldWriter writer(OneCut::FoldFileInfo{"onecut_cli"});
+    std::vector<WorkerReport> reports(workerCount);
+    std::mutex errorMutex;
+
+    auto tracer = std::make_shared<OneCut::Tracer>();
+    if (!options.tracePath.empty()) {
+        OneCut::Tracer::install(tracer);
+    }
+
+    // Files differ a lot in cost, so idle workers take the next one instead of a fixed share
+    auto start = Clock::now();
+    std::atomic<size_t> nextFile{0};
+    auto work = [&](WorkerReport& report) {
+        for (size_t i = nextFile++; i < files.size(); i = nextFile++) {
+            processFile(files[i], options, writer, report, errorMutex);
+        }
+    };
+    std::vector<std::thread> workers;
+    workers.reserve(workerCount - 1);
+    for (size_t worker = 1; worker < workerCount; worker++) {
+        workers.emplace_back(work, std::ref(reports[worker]));
+    }
+    work(reports[0]);
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+    double seconds = elapsedMs(start) / 1000.0;
+
+    if (!options.tracePath.empty()) {
+        OneCut::Tracer::install(nullptr);
+        try {
+            tracer->writeFile(options.tracePath);
+        } catch (const std::exception& e) {
+            std::cerr << e.what() << std::endl;
+        }
+    }
+
+    std::vector<double> latencies;
+    size_t failures = 0;
+    for (const WorkerReport& report : reports) {
+        latencies.insert(latencies.end(), report.latenciesMs.begin(), report.latenciesMs.end());
+        failures += report.failures;
+    }
+    std::sort(latencies.begin(), latencies.end());
+
+    std::cout << "files:        " << files.size() << "\n"
+              << "polygons:     " << latencies.size() << " written, " << failures << " failed\n"
+              << "threads:      " << workerCount << "\n"
+              << "wall time:    " << seconds << " s\n"
+              << "throughput:   " << (seconds > 0 ? latencies.size() / seconds : 0) << " polygons/s\n"
+              << "latency p50:  " << percentile(latencies, 0.5) << " ms\n"
+              << "latency p99:  " << percentile(latencies, 0.99) << " ms\n";
+    double rss = peakRssMb();
+    if (rss >= 0) {
+        std::cout << "peak RSS:     " << rss << " MiB\n";
+    }
+    return failures == 0 ? 0 : 1;
+}